@@ -0,0 +1,79 @@
+/**
+ * \file            bench_port.c
+ * \brief           Host support functions for benchmarks
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwCELL.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v0.1.1
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdlib.h>
+#include <time.h>
+#include "bench_port.h"
+#include "lwcell/lwcell.h"
+#include "lwcell/lwcell_mem.h"
+
+/*
+ * Core lock is required by memory manager and packet buffers.
+ * Benchmarks run in single thread, lock does nothing
+ */
+lwcellr_t
+lwcell_core_lock(void) {
+    return lwcellOK;
+}
+
+lwcellr_t
+lwcell_core_unlock(void) {
+    return lwcellOK;
+}
+
+/**
+ * \brief           Allocate host memory and assign it to library memory manager
+ * \param[in]       size: Size of heap in units of bytes
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+bench_mem_init(size_t size) {
+    static lwcell_mem_region_t region;
+
+    region.start_addr = malloc(size);
+    region.size = size;
+    return region.start_addr != NULL && lwcell_mem_assignmemory(&region, 1);
+}
+
+/**
+ * \brief           Get monotonic time
+ * \return          Time in units of nanoseconds
+ */
+uint64_t
+bench_now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,265 @@
+/**
+ * \file            mem_replay.c
+ * \brief           Allocation trace replay for memory manager
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwCELL.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v0.1.1
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_port.h"
+#include "lwcell/lwcell_mem.h"
+#include "lwcell/lwcell_private.h"
+
+/*
+ * Allocation trace is replayed on library memory manager, built once with first-fit allocator
+ * and once with TLSF allocator (`LWCELL_CFG_MEM_TLSF`). Run both executables with the same trace
+ * and compare time per operation, failed allocations and fragmentation.
+ *
+ * Fragmentation is sampled every `REPLAY_SAMPLE_PERIOD` operations,
+ * as `1 - largest_free_block / available_bytes`. Sampling is not included in timing.
+ * Timing includes overhead of reading monotonic clock, maximal values include host scheduler preemption.
+ *
+ * Trace file has one operation per line, lines starting with `#` are ignored:
+ *
+ *  - `a <id> <size>`: allocate `size` bytes and keep them as `id`
+ *  - `f <id>`: free memory kept as `id`
+ *
+ * When trace file is not given or is `-`, synthetic trace is generated
+ * from allocation sizes and lifetimes typical for the library.
+ *
+ * Usage: mem_replay_ff|mem_replay_tlsf [trace_file|-] [heap_size]
+ */
+
+#define REPLAY_MAX_IDS       4096
+#define REPLAY_SAMPLE_PERIOD 256
+#define REPLAY_SYNTH_OPS     200000
+#define REPLAY_SYNTH_LIVE    96
+
+/**
+ * \brief           Allocation class for synthetic trace
+ */
+typedef struct {
+    size_t min;       /*!< Minimal size in bytes */
+    size_t max;       /*!< Maximal size in bytes */
+    uint32_t weight;  /*!< Relative probability of allocation */
+    uint32_t keep;    /*!< Relative lifetime, higher value lives longer */
+} replay_class_t;
+
+/* Sizes and lifetimes of typical library allocations */
+static const replay_class_t classes[] = {
+    {200, 260, 40, 1},   /* Messages to producer thread */
+    {24, 40, 20, 2},     /* Timeouts */
+    {60, 1520, 30, 3},   /* Received packet buffers */
+    {1460, 1460, 8, 4},  /* Connection write buffers */
+    {120, 160, 2, 50},   /* Netconn objects */
+};
+
+static struct {
+    void* ptr;
+    uint32_t keep;
+} ids[REPLAY_MAX_IDS];
+
+static struct {
+    uint32_t allocs, alloc_fails, frees;
+    uint64_t alloc_ns, alloc_max_ns, free_ns, free_max_ns;
+    uint32_t samples;
+    double frag_sum, frag_max;
+} res;
+
+static uint32_t rnd_state = 0x12345678;
+
+/**
+ * \brief           Deterministic pseudo random generator, same trace for both allocators
+ * \return          Random number
+ */
+static uint32_t
+rnd(void) {
+    rnd_state = rnd_state * 1664525U + 1013904223U;
+    return rnd_state >> 8;
+}
+
+/**
+ * \brief           Sample heap fragmentation
+ */
+static void
+replay_sample(void) {
+    lwcell_mem_stats_t stats;
+
+    if (lwcell_mem_get_stats(&stats) && stats.available_bytes > 0) {
+        double frag = 1.0 - (double)stats.largest_free_block / (double)stats.available_bytes;
+
+        res.frag_sum += frag;
+        res.frag_max = LWCELL_MAX(res.frag_max, frag);
+        ++res.samples;
+    }
+}
+
+/**
+ * \brief           Replay single operation
+ * \param[in]       op: Operation, `a` for allocation, `f` for free
+ * \param[in]       id: Allocation ID
+ * \param[in]       size: Allocation size, used only for allocation
+ */
+static void
+replay_op(char op, size_t id, size_t size) {
+    uint64_t t;
+
+    if (id >= REPLAY_MAX_IDS) {
+        return;
+    }
+    if (op == 'a') {
+        if (ids[id].ptr != NULL) {
+            return; /* Trace error, ID is in use */
+        }
+        t = bench_now_ns();
+        ids[id].ptr = lwcell_mem_malloc(size);
+        t = bench_now_ns() - t;
+        res.alloc_ns += t;
+        res.alloc_max_ns = LWCELL_MAX(res.alloc_max_ns, t);
+        ++res.allocs;
+        if (ids[id].ptr == NULL) {
+            ++res.alloc_fails;
+        }
+    } else if (op == 'f' && ids[id].ptr != NULL) {
+        t = bench_now_ns();
+        lwcell_mem_free(ids[id].ptr);
+        t = bench_now_ns() - t;
+        ids[id].ptr = NULL;
+        res.free_ns += t;
+        res.free_max_ns = LWCELL_MAX(res.free_max_ns, t);
+        ++res.frees;
+    }
+    if (((res.allocs + res.frees) % REPLAY_SAMPLE_PERIOD) == 0) {
+        replay_sample();
+    }
+}
+
+/**
+ * \brief           Replay trace from file
+ * \param[in]       f: Opened trace file
+ */
+static void
+replay_file(FILE* f) {
+    char line[64], op;
+    unsigned long id, size;
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        if (line[0] == '#') {
+            continue;
+        }
+        size = 0;
+        if (sscanf(line, " %c %lu %lu", &op, &id, &size) >= 2) {
+            replay_op(op, (size_t)id, (size_t)size);
+        }
+    }
+}
+
+/**
+ * \brief           Replay generated trace
+ *
+ * Live allocations are freed with probability inverse to their class lifetime,
+ * new ones are allocated while number of live allocations is below limit
+ */
+static void
+replay_synth(void) {
+    uint32_t weights = 0, r;
+    size_t live = 0, id;
+
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(classes); ++i) {
+        weights += classes[i].weight;
+    }
+    for (size_t n = 0; n < REPLAY_SYNTH_OPS; ++n) {
+        if (live < REPLAY_SYNTH_LIVE && (live == 0 || (rnd() & 0x01))) {
+            const replay_class_t* c = classes;
+
+            for (r = rnd() % weights; r >= c->weight; ++c) {
+                r -= c->weight;
+            }
+            for (id = rnd() % REPLAY_MAX_IDS; ids[id].ptr != NULL; id = (id + 1) % REPLAY_MAX_IDS) {}
+            replay_op('a', id, c->min + rnd() % (c->max - c->min + 1));
+            if (ids[id].ptr != NULL) {
+                ids[id].keep = c->keep;
+                ++live;
+            }
+        } else {
+            /* Pick random live allocation, long living ones survive more picks */
+            for (id = rnd() % REPLAY_MAX_IDS;; id = (id + 1) % REPLAY_MAX_IDS) {
+                if (ids[id].ptr != NULL && (rnd() % ids[id].keep) == 0) {
+                    break;
+                }
+            }
+            replay_op('f', id, 0);
+            --live;
+        }
+    }
+}
+
+int
+main(int argc, char** argv) {
+    size_t heap_size = 0x10000;
+    lwcell_mem_stats_t stats;
+
+    if (argc > 2) {
+        heap_size = (size_t)strtoul(argv[2], NULL, 0);
+    }
+    if (!bench_mem_init(heap_size)) {
+        printf("Memory initialization failed\r\n");
+        return 1;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "-") != 0) {
+        FILE* f = fopen(argv[1], "r");
+
+        if (f == NULL) {
+            printf("Cannot open trace file %s\r\n", argv[1]);
+            return 1;
+        }
+        replay_file(f);
+        fclose(f);
+    } else {
+        replay_synth();
+    }
+    replay_sample();
+    lwcell_mem_get_stats(&stats);
+
+    printf("Allocator:         %s\r\n", LWCELL_CFG_MEM_TLSF ? "TLSF" : "first-fit");
+    printf("Heap size:         %u bytes\r\n", (unsigned)heap_size);
+    printf("Allocations:       %u, failed: %u\r\n", (unsigned)res.allocs, (unsigned)res.alloc_fails);
+    printf("Frees:             %u\r\n", (unsigned)res.frees);
+    printf("Alloc time:        avg %u ns, max %u ns\r\n", (unsigned)(res.allocs ? res.alloc_ns / res.allocs : 0),
+           (unsigned)res.alloc_max_ns);
+    printf("Free time:         avg %u ns, max %u ns\r\n", (unsigned)(res.frees ? res.free_ns / res.frees : 0),
+           (unsigned)res.free_max_ns);
+    printf("Peak used:         %u bytes\r\n", (unsigned)stats.peak_used_bytes);
+    printf("Fragmentation:     avg %.1f %%, max %.1f %%\r\n",
+           res.samples ? 100.0 * res.frag_sum / res.samples : 0.0, 100.0 * res.frag_max);
+    return 0;
+}
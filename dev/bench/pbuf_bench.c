@@ -0,0 +1,193 @@
+/**
+ * \file            pbuf_bench.c
+ * \brief           Multi-segment packet buffer compare and search benchmark
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwCELL.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v0.1.1
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_port.h"
+#include "lwcell/lwcell_mem.h"
+#include "lwcell/lwcell_pbuf.h"
+#include "lwcell/lwcell_private.h"
+
+/*
+ * Chain of packet buffers with the same total length is built with different segment sizes.
+ * Library compare and search functions are timed against byte by byte reference,
+ * which reads every byte with lwcell_pbuf_get_at, as library did before segment walk.
+ *
+ * Usage: pbuf_bench [iterations]
+ */
+
+#define BENCH_TOT_LEN   4096
+#define BENCH_HEAP_SIZE 0x40000
+
+static const char needle[] = "+CIPRXGET: 2,0,";
+static const size_t seg_sizes[] = {32, 128, 512, 1460};
+static uint8_t data[BENCH_TOT_LEN];
+
+/**
+ * \brief           Byte by byte compare reference
+ * \param[in]       pbuf: Pbuf chain
+ * \param[in]       d: Data to compare with
+ * \param[in]       len: Length of data
+ * \param[in]       offset: Start offset in chain
+ * \return          `0` if equal, non-zero otherwise
+ */
+static size_t
+ref_memcmp(const lwcell_pbuf_p pbuf, const uint8_t* d, size_t len, size_t offset) {
+    lwcell_pbuf_p p;
+    uint8_t el;
+
+    if (pbuf->tot_len < (offset + len)) {
+        return LWCELL_SIZET_MAX;
+    }
+    for (p = pbuf; p != NULL && p->len <= offset; p = p->next) {
+        offset -= p->len;
+    }
+    for (size_t i = 0; i < len; ++i) {
+        if (!lwcell_pbuf_get_at(p, offset + i, &el) || el != d[i]) {
+            return offset + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Byte by byte search reference, compares at every offset
+ * \param[in]       pbuf: Pbuf chain
+ * \param[in]       d: Needle
+ * \param[in]       len: Length of needle
+ * \param[in]       off: Start offset in chain
+ * \return          Position of match or `LWCELL_SIZET_MAX`
+ */
+static size_t
+ref_memfind(const lwcell_pbuf_p pbuf, const uint8_t* d, size_t len, size_t off) {
+    for (size_t i = off; i <= pbuf->tot_len - len; ++i) {
+        if (!ref_memcmp(pbuf, d, len, i)) {
+            return i;
+        }
+    }
+    return LWCELL_SIZET_MAX;
+}
+
+/**
+ * \brief           Create chain of packet buffers with test data
+ * \param[in]       seg: Length of each segment
+ * \return          Chain head on success, `NULL` otherwise
+ */
+static lwcell_pbuf_p
+chain_create(size_t seg) {
+    lwcell_pbuf_p head = NULL, p;
+
+    for (size_t len = 0; len < BENCH_TOT_LEN; len += seg) {
+        p = lwcell_pbuf_new(LWCELL_MIN(seg, BENCH_TOT_LEN - len));
+        if (p == NULL) {
+            lwcell_pbuf_free_s(&head);
+            return NULL;
+        }
+        if (head == NULL) {
+            head = p;
+        } else {
+            lwcell_pbuf_cat(head, p);
+        }
+    }
+    lwcell_pbuf_take(head, data, sizeof(data), 0);
+    return head;
+}
+
+int
+main(int argc, char** argv) {
+    size_t iters = 200, pos = 0, ref_pos = 0, cmp = 0, ref_cmp = 0;
+    size_t needle_pos = BENCH_TOT_LEN - sizeof(needle) + 1;
+    uint64_t t_find, t_ref_find, t_cmp, t_ref_cmp, t;
+
+    if (argc > 1) {
+        iters = (size_t)strtoul(argv[1], NULL, 10);
+    }
+    if (iters == 0 || !bench_mem_init(BENCH_HEAP_SIZE)) {
+        printf("Initialization failed\r\n");
+        return 1;
+    }
+
+    /* Printable data with needle at the end, first needle byte repeats to exercise partial matches */
+    for (size_t i = 0; i < sizeof(data); ++i) {
+        data[i] = (uint8_t)((i % 7) == 0 ? '+' : ('a' + (i % 23)));
+    }
+    memcpy(&data[needle_pos], needle, sizeof(needle) - 1);
+
+    printf("%8s %8s %14s %14s %14s %14s\r\n", "seg", "segs", "memfind ns", "ref find ns", "memcmp ns",
+           "ref cmp ns");
+    for (size_t s = 0; s < LWCELL_ARRAYSIZE(seg_sizes); ++s) {
+        lwcell_pbuf_p p = chain_create(seg_sizes[s]);
+
+        if (p == NULL) {
+            printf("Chain allocation failed\r\n");
+            return 1;
+        }
+
+        t = bench_now_ns();
+        for (size_t i = 0; i < iters; ++i) {
+            pos = lwcell_pbuf_memfind(p, needle, sizeof(needle) - 1, 0);
+        }
+        t_find = bench_now_ns() - t;
+
+        t = bench_now_ns();
+        for (size_t i = 0; i < iters; ++i) {
+            ref_pos = ref_memfind(p, (const uint8_t*)needle, sizeof(needle) - 1, 0);
+        }
+        t_ref_find = bench_now_ns() - t;
+
+        t = bench_now_ns();
+        for (size_t i = 0; i < iters; ++i) {
+            cmp |= lwcell_pbuf_memcmp(p, data, sizeof(data), 0);
+        }
+        t_cmp = bench_now_ns() - t;
+
+        t = bench_now_ns();
+        for (size_t i = 0; i < iters; ++i) {
+            ref_cmp |= ref_memcmp(p, data, sizeof(data), 0);
+        }
+        t_ref_cmp = bench_now_ns() - t;
+
+        printf("%8u %8u %14u %14u %14u %14u\r\n", (unsigned)seg_sizes[s],
+               (unsigned)((BENCH_TOT_LEN + seg_sizes[s] - 1) / seg_sizes[s]), (unsigned)(t_find / iters),
+               (unsigned)(t_ref_find / iters), (unsigned)(t_cmp / iters), (unsigned)(t_ref_cmp / iters));
+        lwcell_pbuf_free_s(&p);
+
+        if (pos != needle_pos || ref_pos != needle_pos || cmp != 0 || ref_cmp != 0) {
+            printf("Result mismatch: find %u, ref find %u, expected %u, cmp %u, ref cmp %u\r\n", (unsigned)pos,
+                   (unsigned)ref_pos, (unsigned)needle_pos, (unsigned)cmp, (unsigned)ref_cmp);
+            return 1;
+        }
+    }
+    return 0;
+}
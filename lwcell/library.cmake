@@ -23,6 +23,7 @@ set(lwcell_core_SRCS
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_conn.c
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_debug.c
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_device_info.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_dns.c
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_evt.c
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_http.c
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_input.c
@@ -35,6 +36,7 @@ set(lwcell_core_SRCS
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_phonebook.c
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_sim.c
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_sms.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_sms_pdu.c
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_threads.c
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_timeout.c
     ${CMAKE_CURRENT_LIST_DIR}/src/lwcell/lwcell_unicode.c
@@ -47,33 +47,86 @@
 #error "LWCELL_CFG_NETCONN_RECEIVE_QUEUE_LEN must be greater or equal to 2"
 #endif /* LWCELL_CFG_NETCONN_RECEIVE_QUEUE_LEN < 2 */
 
+static uint8_t recv_closed = 0xFF;
+static lwcell_netconn_t* netconn_list; /*!< Linked list of netconn entries */
+#if LWCELL_CFG_CONN_SERVER
+static lwcell_netconn_t* listen_api; /*!< Netconn in listening mode */
+#endif                              /* LWCELL_CFG_CONN_SERVER */
+
 /**
- * \brief           Sequential API structure
+ * \brief           Track new entry in netconn queue and wake up thread waiting in poll
+ * \note            Core must be locked when using this macro
+ * \param[in]       nc: Netconn handle
+ * \param[in]       cnt: Queue counter field name
  */
-typedef struct lwcell_netconn {
-    struct lwcell_netconn* next;    /*!< Linked list entry */
+#if LWCELL_CFG_NETCONN_POLL
+#define NETCONN_POLL_PUT(nc, cnt)                                                                                      \
+    do {                                                                                                               \
+        ++(nc)->cnt;                                                                                                   \
+        if ((nc)->poll_sem != NULL) {                                                                                  \
+            lwcell_sys_sem_release((nc)->poll_sem);                                                                    \
+        }                                                                                                              \
+    } while (0)
+#define NETCONN_POLL_GET(nc, cnt)                                                                                      \
+    do {                                                                                                               \
+        lwcell_core_lock();                                                                                            \
+        if ((nc)->cnt > 0) {                                                                                           \
+            --(nc)->cnt;                                                                                               \
+        }                                                                                                              \
+        lwcell_core_unlock();                                                                                          \
+    } while (0)
+#else /* LWCELL_CFG_NETCONN_POLL */
+#define NETCONN_POLL_PUT(nc, cnt)
+#define NETCONN_POLL_GET(nc, cnt)
+#endif /* !LWCELL_CFG_NETCONN_POLL */
 
-    lwcell_netconn_type_t type;     /*!< Netconn type */
+#if LWCELL_CFG_CONN_SERVER
 
-    size_t rcv_packets;            /*!< Number of received packets so far on this connection */
-    lwcell_conn_p conn;             /*!< Pointer to actual connection */
+/**
+ * \brief           Close connections waiting to be accepted and remove closed markers
+ * \note            Core must be locked when calling this function
+ * \param[in]       nc: Pointer to listening netconn
+ */
+static void
+accept_drain(lwcell_netconn_t* nc) {
+    lwcell_netconn_t* new_nc;
 
-    lwcell_sys_mbox_t mbox_receive; /*!< Message queue for receive mbox */
+    while (lwcell_sys_mbox_getnow(&nc->mbox_accept, (void**)&new_nc)) {
+        if (new_nc != NULL && (uint8_t*)new_nc != (uint8_t*)&recv_closed) {
+            if (new_nc->conn != NULL) {
+                lwcell_conn_set_arg(new_nc->conn, NULL);
+                lwcell_conn_close(new_nc->conn, 0); /* Close not yet accepted connection */
+            }
+            lwcell_netconn_delete(new_nc);          /* Free memory for API */
+        }
+    }
+#if LWCELL_CFG_NETCONN_POLL
+    nc->accept_pending = 0;
+#endif /* LWCELL_CFG_NETCONN_POLL */
+}
 
-    lwcell_linbuff_t buff;          /*!< Linear buffer structure */
+#endif /* LWCELL_CFG_CONN_SERVER */
 
-    uint16_t conn_timeout;         /*!< Connection timeout in units of seconds when
-                                                    netconn is in server (listen) mode.
-                                                    Connection will be automatically closed if there is no
-                                                    data exchange in time. Set to `0` when timeout feature is disabled. */
+#if LWCELL_CFG_CONN_MANUAL_RX
 
-#if LWCELL_CFG_NETCONN_RECEIVE_TIMEOUT || __DOXYGEN__
-    uint32_t rcv_timeout; /*!< Receive timeout in unit of milliseconds */
-#endif
-} lwcell_netconn_t;
+/**
+ * \brief           Confirm data read by application to connection they were received on
+ *
+ * Nothing is confirmed if connection was closed or reused for new connection in the meantime
+ *
+ * \param[in]       nc: Netconn handle
+ * \param[in]       pbuf: Packet buffer taken from receive mbox
+ */
+static void
+netconn_recved(lwcell_netconn_t* nc, lwcell_pbuf_p pbuf) {
+    lwcell_core_lock();
+    if (nc->conn != NULL && nc->conn->val_id == nc->conn_val_id && lwcell_conn_is_active(nc->conn)) {
+        lwcell_conn_recved(nc->conn, pbuf);
+    }
+    lwcell_core_unlock();
+}
 
-static uint8_t recv_closed = 0xFF;
-static lwcell_netconn_t* netconn_list; /*!< Linked list of netconn entries */
+#endif /* LWCELL_CFG_CONN_MANUAL_RX */
 
 /**
  * \brief           Flush all mboxes and clear possible used memories
@@ -94,7 +147,17 @@ flush_mboxes(lwcell_netconn_t* nc, uint8_t protect) {
         }
         lwcell_sys_mbox_delete(&nc->mbox_receive);  /* Delete message queue */
         lwcell_sys_mbox_invalid(&nc->mbox_receive); /* Invalid handle */
+#if LWCELL_CFG_NETCONN_POLL
+        nc->rcv_pending = 0;
+#endif /* LWCELL_CFG_NETCONN_POLL */
     }
+#if LWCELL_CFG_CONN_SERVER
+    if (lwcell_sys_mbox_isvalid(&nc->mbox_accept)) {
+        accept_drain(nc);
+        lwcell_sys_mbox_delete(&nc->mbox_accept);  /* Delete message queue */
+        lwcell_sys_mbox_invalid(&nc->mbox_accept); /* Invalid handle */
+    }
+#endif /* LWCELL_CFG_CONN_SERVER */
     if (protect) {
         lwcell_core_unlock();
     }
@@ -126,10 +189,40 @@ netconn_evt(lwcell_evt_t* evt) {
                     close = 1;                 /* Close this connection, invalid netconn */
                 }
             } else {
+#if LWCELL_CFG_CONN_SERVER
+                /* Connection accepted by server, create new netconn and put it to accept queue */
+                if (listen_api != NULL && lwcell_sys_mbox_isvalid(&listen_api->mbox_accept)) {
+                    nc = lwcell_netconn_new(LWCELL_NETCONN_TYPE_TCP);
+                    if (nc != NULL) {
+                        nc->conn = conn;
+                        nc->conn_timeout = listen_api->conn_timeout;
+                        lwcell_conn_set_arg(conn, nc);
+                        if (lwcell_sys_mbox_putnow(&listen_api->mbox_accept, nc)) {
+                            NETCONN_POLL_PUT(listen_api, accept_pending);
+                        } else {
+                            LWCELL_DEBUGF(LWCELL_CFG_DBG_NETCONN | LWCELL_DBG_TYPE_TRACE | LWCELL_DBG_LVL_WARNING,
+                                          "[LWCELL NETCONN] Accept queue is full, closing connection\r\n");
+                            close = 1;
+                        }
+                    } else {
+                        close = 1;
+                    }
+                } else {
+                    LWCELL_DEBUGF(LWCELL_CFG_DBG_NETCONN | LWCELL_DBG_TYPE_TRACE | LWCELL_DBG_LVL_WARNING,
+                                  "[LWCELL NETCONN] Closing connection, there is no listening netconn!\r\n");
+                    close = 1;
+                }
+#else  /* LWCELL_CFG_CONN_SERVER */
                 LWCELL_DEBUGF(LWCELL_CFG_DBG_NETCONN | LWCELL_DBG_TYPE_TRACE | LWCELL_DBG_LVL_WARNING,
                              "[LWCELL NETCONN] Closing connection, it is not in client mode!\r\n");
                 close = 1; /* Close the connection at this point */
+#endif /* !LWCELL_CFG_CONN_SERVER */
             }
+#if LWCELL_CFG_CONN_MANUAL_RX
+            if (!close) {
+                lwcell_conn_set_rx_manual_ack(conn, 1); /* Data are confirmed when application reads them */
+            }
+#endif /* LWCELL_CFG_CONN_MANUAL_RX */
 
             /* Decide if some events want to close the connection */
             if (close) {
@@ -153,16 +246,28 @@ netconn_evt(lwcell_evt_t* evt) {
             nc = lwcell_conn_get_arg(conn);            /* Get API from connection */
             pbuf = lwcell_evt_conn_recv_get_buff(evt); /* Get received buff */
 
+#if !LWCELL_CFG_CONN_MANUAL_RX
             lwcell_conn_recved(conn, pbuf);            /* Notify stack about received data */
+#endif                                                 /* !LWCELL_CFG_CONN_MANUAL_RX */
 
             lwcell_pbuf_ref(pbuf);                     /* Increase reference counter */
             if (nc == NULL || !lwcell_sys_mbox_isvalid(&nc->mbox_receive)
                 || !lwcell_sys_mbox_putnow(&nc->mbox_receive, pbuf)) {
                 LWCELL_DEBUGF(LWCELL_CFG_DBG_NETCONN, "[LWCELL NETCONN] Ignoring more data for receive!\r\n");
+#if LWCELL_CFG_CONN_MANUAL_RX
+                lwcell_conn_recved(conn, pbuf); /* Data are dropped, release receive window */
+#endif                                          /* LWCELL_CFG_CONN_MANUAL_RX */
                 lwcell_pbuf_free_s(&pbuf); /* Free pbuf */
                 return lwcellOKIGNOREMORE; /* Return OK to free the memory and ignore further data */
             }
             ++nc->rcv_packets;            /* Increase number of received packets */
+#if LWCELL_CFG_CONN_MANUAL_RX
+            nc->conn_val_id = conn->val_id; /* Data are confirmed only to this connection */
+#endif                                      /* LWCELL_CFG_CONN_MANUAL_RX */
+            NETCONN_POLL_PUT(nc, rcv_pending);
+#if LWCELL_CFG_CONN_SERVER
+            nc->conn_idle = 0; /* Data exchanged, reset idle time */
+#endif                         /* LWCELL_CFG_CONN_SERVER */
             LWCELL_DEBUGF(LWCELL_CFG_DBG_NETCONN | LWCELL_DBG_TYPE_TRACE,
                          "[LWCELL NETCONN] Received pbuf contains %d bytes. Handle written to receive mbox\r\n",
                          (int)lwcell_pbuf_length(pbuf, 0));
@@ -177,12 +282,37 @@ netconn_evt(lwcell_evt_t* evt) {
              * In case we have a netconn available,
              * simply write pointer to received variable to indicate closed state
              */
-            if (nc != NULL && lwcell_sys_mbox_isvalid(&nc->mbox_receive)) {
-                lwcell_sys_mbox_putnow(&nc->mbox_receive, (void*)&recv_closed);
+            if (nc != NULL && lwcell_sys_mbox_isvalid(&nc->mbox_receive)
+                && lwcell_sys_mbox_putnow(&nc->mbox_receive, (void*)&recv_closed)) {
+                NETCONN_POLL_PUT(nc, rcv_pending);
+            }
+
+            break;
+        }
+#if LWCELL_CFG_CONN_SERVER
+        /* Data were sent, connection is not idle */
+        case LWCELL_EVT_CONN_SEND: {
+            nc = lwcell_conn_get_arg(conn);
+            if (nc != NULL) {
+                nc->conn_idle = 0;
             }
+            break;
+        }
 
+        /* Close connection when there was no data exchange within timeout */
+        case LWCELL_EVT_CONN_POLL: {
+            nc = lwcell_conn_get_arg(conn);
+            if (nc != NULL && nc->conn_timeout > 0) {
+                nc->conn_idle += LWCELL_CFG_CONN_POLL_INTERVAL;
+                if (nc->conn_idle >= (uint32_t)nc->conn_timeout * 1000) {
+                    LWCELL_DEBUGF(LWCELL_CFG_DBG_NETCONN | LWCELL_DBG_TYPE_TRACE,
+                                  "[LWCELL NETCONN] Closing idle connection\r\n");
+                    lwcell_conn_close(conn, 0);
+                }
+            }
             break;
         }
+#endif /* LWCELL_CFG_CONN_SERVER */
         default: return lwcellERR;
     }
     return lwcellOK;
@@ -196,6 +326,17 @@ netconn_evt(lwcell_evt_t* evt) {
 static lwcellr_t
 lwcell_evt(lwcell_evt_t* evt) {
     switch (lwcell_evt_get_type(evt)) {
+#if LWCELL_CFG_CONN_SERVER
+        case LWCELL_EVT_SERVER: {
+            /* Server stopped, notify thread waiting in accept */
+            if (!lwcell_evt_server_is_enable(evt) && listen_api != NULL
+                && lwcell_sys_mbox_isvalid(&listen_api->mbox_accept)
+                && lwcell_sys_mbox_putnow(&listen_api->mbox_accept, (void*)&recv_closed)) {
+                NETCONN_POLL_PUT(listen_api, accept_pending);
+            }
+            break;
+        }
+#endif /* LWCELL_CFG_CONN_SERVER */
         default: break;
     }
     return lwcellOK;
@@ -218,10 +359,13 @@ lwcell_netconn_new(lwcell_netconn_type_t type) {
         lwcell_evt_register(lwcell_evt); /* Register global event function */
     }
     lwcell_core_unlock();
-    a = lwcell_mem_calloc(1, sizeof(*a)); /* Allocate memory for core object */
+    a = LWCELL_MEM_CALLOC(1, sizeof(*a), LWCELL_MEM_TAG_NETCONN); /* Allocate memory for core object */
     if (a != NULL) {
         a->type = type;                  /* Save netconn type */
         a->conn_timeout = 0;             /* Default connection timeout */
+#if LWCELL_CFG_CONN_SERVER
+        lwcell_sys_mbox_invalid(&a->mbox_accept); /* Accept queue is created on listen */
+#endif                                            /* LWCELL_CFG_CONN_SERVER */
         if (!lwcell_sys_mbox_create(
                 &a->mbox_receive,
                 LWCELL_CFG_NETCONN_RECEIVE_QUEUE_LEN)) { /* Allocate memory for receiving message box */
@@ -260,6 +404,11 @@ lwcell_netconn_delete(lwcell_netconn_p nc) {
     LWCELL_ASSERT(nc != NULL);
 
     lwcell_core_lock();
+#if LWCELL_CFG_CONN_SERVER
+    if (listen_api == nc) {
+        listen_api = NULL; /* Stop accepting new connections */
+    }
+#endif                   /* LWCELL_CFG_CONN_SERVER */
     flush_mboxes(nc, 0); /* Clear mboxes */
 
     /* Remove netconn from linkedlist */
@@ -307,6 +456,114 @@ lwcell_netconn_connect(lwcell_netconn_p nc, const char* host, lwcell_port_t port
     return res;
 }
 
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+
+/**
+ * \brief           Bind a connection to specific port, can be only used for server connections
+ * \param[in]       nc: Netconn handle
+ * \param[in]       port: Port used to bind a connection to
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_netconn_bind(lwcell_netconn_p nc, lwcell_port_t port) {
+    LWCELL_ASSERT(nc != NULL);
+    LWCELL_ASSERT(port > 0);
+
+    nc->listen_port = port;
+    return lwcellOK;
+}
+
+/**
+ * \brief           Set timeout value in units of seconds when connection is in listening mode
+ *
+ * Accepted connections are automatically closed when there is no data exchange within timeout.
+ * Value is applied to connections accepted after the call.
+ *
+ * \param[in]       nc: Netconn handle used as listening connection
+ * \param[in]       timeout: Time in units of seconds. Set to `0` to disable timeout feature
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_netconn_set_listen_conn_timeout(lwcell_netconn_p nc, uint16_t timeout) {
+    LWCELL_ASSERT(nc != NULL);
+
+    lwcell_core_lock();
+    nc->conn_timeout = timeout;
+    lwcell_core_unlock();
+    return lwcellOK;
+}
+
+/**
+ * \brief           Listen on previously binded connection
+ *
+ * Only one netconn can be in listening mode at a time.
+ * Up to \ref LWCELL_CFG_NETCONN_ACCEPT_QUEUE_LEN new connections wait to be accepted,
+ * others are closed immediately.
+ *
+ * \param[in]       nc: Netconn handle used to listen for new connections
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_netconn_listen(lwcell_netconn_p nc) {
+    lwcellr_t res;
+
+    LWCELL_ASSERT(nc != NULL);
+    LWCELL_ASSERT(nc->type == LWCELL_NETCONN_TYPE_TCP);
+    LWCELL_ASSERT(nc->listen_port > 0);
+
+    lwcell_core_lock();
+    if (listen_api != NULL && listen_api != nc) {
+        lwcell_core_unlock();
+        return lwcellERR; /* Another netconn is already listening */
+    }
+    if (lwcell_sys_mbox_isvalid(&nc->mbox_accept)) {
+        if (listen_api == NULL) {
+            accept_drain(nc); /* Remove closed marker left by previous close */
+        }
+    } else if (!lwcell_sys_mbox_create(&nc->mbox_accept, LWCELL_CFG_NETCONN_ACCEPT_QUEUE_LEN)) {
+        lwcell_core_unlock();
+        return lwcellERRMEM;
+    }
+    listen_api = nc;
+    lwcell_core_unlock();
+
+    /* Enable server on device with netconn callback function */
+    res = lwcell_conn_set_server(1, nc->listen_port, netconn_evt, 1);
+    if (res != lwcellOK) {
+        lwcell_core_lock();
+        listen_api = NULL;
+        lwcell_core_unlock();
+    }
+    return res;
+}
+
+/**
+ * \brief           Accept a new connection
+ * \param[in]       nc: Netconn handle used as base connection to accept new clients
+ * \param[out]      client: Pointer to netconn handle to save new connection to
+ * \return          \ref lwcellOK on success, \ref lwcellCLOSED when server was closed,
+ *                  member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_netconn_accept(lwcell_netconn_p nc, lwcell_netconn_p* client) {
+    lwcell_netconn_t* tmp;
+
+    LWCELL_ASSERT(nc != NULL);
+    LWCELL_ASSERT(client != NULL);
+    LWCELL_ASSERT(lwcell_sys_mbox_isvalid(&nc->mbox_accept));
+
+    *client = NULL;
+    lwcell_sys_mbox_get(&nc->mbox_accept, (void**)&tmp, 0);
+    NETCONN_POLL_GET(nc, accept_pending);
+    if ((uint8_t*)tmp == (uint8_t*)&recv_closed) {
+        return lwcellCLOSED;
+    }
+    *client = tmp; /* Set new pointer */
+    return lwcellOK;
+}
+
+#endif /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
+
 /**
  * \brief           Write data to connection output buffers
  * \note            This function may only be used on TCP or SSL connections
@@ -376,7 +633,8 @@ lwcell_netconn_write(lwcell_netconn_p nc, const void* data, size_t btw) {
 
     /* Step 3 */
     if (nc->buff.buff == NULL) {                    /* Check if we should allocate a new buffer */
-        nc->buff.buff = lwcell_mem_malloc(sizeof(*nc->buff.buff) * LWCELL_CFG_CONN_MAX_DATA_LEN);
+        nc->buff.buff =
+            LWCELL_MEM_MALLOC(sizeof(*nc->buff.buff) * LWCELL_CFG_CONN_MAX_DATA_LEN, LWCELL_MEM_TAG_CONN_BUFF);
         nc->buff.len = LWCELL_CFG_CONN_MAX_DATA_LEN; /* Save buffer length */
         nc->buff.ptr = 0;                           /* Save buffer pointer */
     }
@@ -507,15 +765,95 @@ lwcell_netconn_receive(lwcell_netconn_p nc, lwcell_pbuf_p* pbuf) {
     /* Forever wait for new receive packet */
     lwcell_sys_mbox_get(&nc->mbox_receive, (void**)pbuf, 0);
 #endif /* !LWCELL_CFG_NETCONN_RECEIVE_TIMEOUT */
+    NETCONN_POLL_GET(nc, rcv_pending);
 
     /* Check if connection closed */
     if ((uint8_t*)(*pbuf) == (uint8_t*)&recv_closed) {
         *pbuf = NULL; /* Reset pbuf */
         return lwcellCLOSED;
     }
+#if LWCELL_CFG_CONN_MANUAL_RX
+    netconn_recved(nc, *pbuf); /* Reader consumed data, stack may read more from device */
+#endif                         /* LWCELL_CFG_CONN_MANUAL_RX */
     return lwcellOK; /* We have data available */
 }
 
+/**
+ * \brief           Receive all queued data from connection as single packet buffer chain
+ *
+ * Function waits for first packet buffer and then takes all packet buffers already in receive queue.
+ * When there is less than `min_len` bytes received, it continues to wait for more data until timeout expires.
+ *
+ * \note            When connection closes while data are being collected, received data are returned first
+ *                  and next receive call returns \ref lwcellCLOSED
+ * \param[in]       nc: Netconn handle used to receive from
+ * \param[in]       pbuf: Pointer to pointer to save received packet buffer chain to.
+ *                     When function returns, user must check for valid pbuf value `pbuf != NULL`
+ * \param[in]       min_len: Minimal number of bytes to collect before function returns.
+ *                      Set to `0` to return as soon as any data are available
+ * \param[in]       timeout: Timeout in units of milliseconds for whole call.
+ *                      Set to `0` to wait forever,
+ *                      set to \ref LWCELL_NETCONN_RECEIVE_NO_WAIT to only take currently queued data
+ * \return          \ref lwcellOK when new data ready, even if less than `min_len` bytes were received before timeout,
+ * \return          \ref lwcellCLOSED when connection closed by remote side,
+ * \return          \ref lwcellTIMEOUT when no data received within timeout
+ * \return          Any other member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_netconn_receive_batch(lwcell_netconn_p nc, lwcell_pbuf_p* pbuf, size_t min_len, uint32_t timeout) {
+    lwcell_pbuf_p head = NULL, p;
+    uint32_t waited;
+    size_t len = 0;
+
+    LWCELL_ASSERT(nc != NULL);
+    LWCELL_ASSERT(pbuf != NULL);
+
+    *pbuf = NULL;
+    while (1) {
+        /* Take queued entries without blocking, wait only when queue is empty */
+        if (!lwcell_sys_mbox_getnow(&nc->mbox_receive, (void**)&p)) {
+            if ((head != NULL && len >= min_len) || timeout == LWCELL_NETCONN_RECEIVE_NO_WAIT) {
+                break;
+            }
+            waited = lwcell_sys_mbox_get(&nc->mbox_receive, (void**)&p, timeout);
+            if (waited == LWCELL_SYS_TIMEOUT) {
+                break;
+            } else if (timeout > 0) {
+                timeout = waited < timeout ? (timeout - waited) : LWCELL_NETCONN_RECEIVE_NO_WAIT;
+            }
+        }
+        NETCONN_POLL_GET(nc, rcv_pending);
+
+        /* Check if connection closed */
+        if ((uint8_t*)p == (uint8_t*)&recv_closed) {
+            if (head == NULL) {
+                return lwcellCLOSED;
+            }
+
+            /* Return data first, put close marker back for next receive call */
+            lwcell_core_lock();
+            if (lwcell_sys_mbox_putnow(&nc->mbox_receive, p)) {
+                NETCONN_POLL_PUT(nc, rcv_pending);
+            }
+            lwcell_core_unlock();
+            break;
+        }
+#if LWCELL_CFG_CONN_MANUAL_RX
+        netconn_recved(nc, p); /* Reader consumed data, stack may read more from device */
+#endif                         /* LWCELL_CFG_CONN_MANUAL_RX */
+        len += lwcell_pbuf_length(p, 1);
+        if (head == NULL) {
+            head = p;
+        } else {
+            lwcell_pbuf_chain(head, p); /* Head now references received packet buffer */
+            lwcell_pbuf_free(p);        /* Release reference from receive queue */
+        }
+    }
+
+    *pbuf = head;
+    return head != NULL ? lwcellOK : lwcellTIMEOUT;
+}
+
 /**
  * \brief           Close a netconn connection
  * \param[in]       nc: Netconn handle to close
@@ -526,6 +864,27 @@ lwcell_netconn_close(lwcell_netconn_p nc) {
     lwcell_conn_p conn;
 
     LWCELL_ASSERT(nc != NULL);
+#if LWCELL_CFG_CONN_SERVER
+    /*
+     * Listening netconn has no connection, stop the server instead.
+     *
+     * Accept queue is kept until netconn is deleted, as other thread may still wait on it.
+     * Pending connections are closed and closed marker wakes up thread in accept or poll
+     */
+    if (nc->conn == NULL && lwcell_sys_mbox_isvalid(&nc->mbox_accept)) {
+        lwcell_conn_set_server(0, nc->listen_port, NULL, 1);
+        lwcell_core_lock();
+        if (listen_api == nc) {
+            listen_api = NULL;
+        }
+        accept_drain(nc);
+        if (lwcell_sys_mbox_putnow(&nc->mbox_accept, (void*)&recv_closed)) {
+            NETCONN_POLL_PUT(nc, accept_pending);
+        }
+        lwcell_core_unlock();
+        return lwcellOK;
+    }
+#endif /* LWCELL_CFG_CONN_SERVER */
     LWCELL_ASSERT(nc->conn != NULL);
     LWCELL_ASSERT(lwcell_conn_is_active(nc->conn));
 
@@ -584,4 +943,131 @@ lwcell_netconn_get_receive_timeout(lwcell_netconn_p nc) {
 
 #endif /* LWCELL_CFG_NETCONN_RECEIVE_TIMEOUT || __DOXYGEN__ */
 
+#if LWCELL_CFG_NETCONN_POLL || __DOXYGEN__
+
+/**
+ * \brief           Check events ready on netconn
+ * \note            Core must be locked when calling this function
+ * \param[in,out]   entry: Poll entry to check and set returned events to
+ * \return          `1` if any event is ready, `0` otherwise
+ */
+static uint8_t
+netconn_poll_check(lwcell_netconn_poll_t* entry) {
+    lwcell_netconn_t* nc = entry->nc;
+    uint8_t ev = 0;
+
+#if LWCELL_CFG_CONN_SERVER
+    if (nc->conn == NULL && lwcell_sys_mbox_isvalid(&nc->mbox_accept)) {
+        if (nc->accept_pending > 0) {
+            ev |= LWCELL_NETCONN_POLL_READ; /* Accept will not block */
+        }
+    } else
+#endif /* LWCELL_CFG_CONN_SERVER */
+    {
+        if (nc->rcv_pending > 0) {
+            ev |= LWCELL_NETCONN_POLL_READ; /* Data or close marker in receive queue */
+        }
+        if (nc->conn == NULL || !lwcell_conn_is_active(nc->conn)) {
+            ev |= LWCELL_NETCONN_POLL_CLOSED;
+        } else {
+            ev |= LWCELL_NETCONN_POLL_WRITE;
+        }
+    }
+    entry->revents = ev & (entry->events | LWCELL_NETCONN_POLL_CLOSED);
+    return entry->revents != 0;
+}
+
+/**
+ * \brief           Wait for events on multiple netconns at the same time
+ *
+ * Function blocks until at least one netconn in the set is ready for requested events or timeout expires.
+ * Single semaphore is shared by all netconns in the set, netconn callback releases it
+ * when new data, new connection or close event is written to netconn queue.
+ *
+ * For listening netconn, \ref LWCELL_NETCONN_POLL_READ means \ref lwcell_netconn_accept will not block.
+ * For other netconns, it means \ref lwcell_netconn_receive will not block.
+ *
+ * \note            Netconn may be polled by one thread at a time
+ * \param[in,out]   set: Array of poll entries. `revents` field is set for each entry on return
+ * \param[in]       n: Number of entries in array
+ * \param[in]       timeout: Timeout in units of milliseconds.
+ *                      Set to `0` to wait forever,
+ *                      set to \ref LWCELL_NETCONN_RECEIVE_NO_WAIT to only check current status
+ * \param[out]      ready: Pointer to output number of entries with events. Set to `NULL` if not used
+ * \return          \ref lwcellOK when at least one netconn is ready,
+ * \return          \ref lwcellTIMEOUT when no event occurred within timeout,
+ * \return          Any other member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_netconn_poll(lwcell_netconn_poll_t* set, size_t n, uint32_t timeout, size_t* ready) {
+    lwcell_sys_sem_t sem;
+    lwcellr_t res = lwcellOK;
+    uint32_t waited;
+    size_t cnt;
+
+    LWCELL_ASSERT(set != NULL);
+    LWCELL_ASSERT(n > 0);
+
+    lwcell_sys_sem_invalid(&sem);
+    while (1) {
+        lwcell_core_lock();
+        cnt = 0;
+        for (size_t i = 0; i < n; ++i) {
+            cnt += netconn_poll_check(&set[i]);
+        }
+        if (cnt == 0 && timeout != LWCELL_NETCONN_RECEIVE_NO_WAIT && lwcell_sys_sem_isvalid(&sem)) {
+            for (size_t i = 0; i < n; ++i) {
+                set[i].nc->poll_sem = &sem; /* Callback will wake us up */
+            }
+        }
+        lwcell_core_unlock();
+
+        if (cnt > 0 || timeout == LWCELL_NETCONN_RECEIVE_NO_WAIT) {
+            break;
+        }
+        if (!lwcell_sys_sem_isvalid(&sem)) {
+            /* Create semaphore on first wait and check again, events may have happened meanwhile */
+            if (!lwcell_sys_sem_create(&sem, 0)) {
+                res = lwcellERRMEM;
+                break;
+            }
+            continue;
+        }
+
+        waited = lwcell_sys_sem_wait(&sem, timeout);
+        if (waited == LWCELL_SYS_TIMEOUT) {
+            break;
+        } else if (timeout > 0) {
+            timeout = waited < timeout ? (timeout - waited) : LWCELL_NETCONN_RECEIVE_NO_WAIT;
+        }
+    }
+
+    if (lwcell_sys_sem_isvalid(&sem)) {
+        lwcell_core_lock();
+        for (size_t i = 0; i < n; ++i) {
+            if (set[i].nc->poll_sem == &sem) {
+                set[i].nc->poll_sem = NULL;
+            }
+        }
+        if (cnt == 0) {
+            for (size_t i = 0; i < n; ++i) {
+                cnt += netconn_poll_check(&set[i]); /* Last check after timeout */
+            }
+        }
+        lwcell_core_unlock();
+        lwcell_sys_sem_delete(&sem);
+        lwcell_sys_sem_invalid(&sem);
+    }
+
+    if (ready != NULL) {
+        *ready = cnt;
+    }
+    if (res == lwcellOK && cnt == 0) {
+        res = lwcellTIMEOUT;
+    }
+    return res;
+}
+
+#endif /* LWCELL_CFG_NETCONN_POLL || __DOXYGEN__ */
+
 #endif /* LWCELL_CFG_NETCONN || __DOXYGEN__ */
@@ -1088,7 +1088,7 @@ lwcell_mqtt_client_t*
 lwcell_mqtt_client_new(size_t tx_buff_len, size_t rx_buff_len) {
     lwcell_mqtt_client_p client;
 
-    if ((client = lwcell_mem_calloc(1, sizeof(*client))) != NULL) {
+    if ((client = LWCELL_MEM_CALLOC(1, sizeof(*client), LWCELL_MEM_TAG_MQTT)) != NULL) {
         client->conn_state = LWCELL_MQTT_CONN_DISCONNECTED; /* Set to disconnected mode */
 
         if (!lwcell_buff_init(&client->tx_buff, tx_buff_len)) {
@@ -1096,7 +1096,7 @@ lwcell_mqtt_client_new(size_t tx_buff_len, size_t rx_buff_len) {
         }
         if (client != NULL) {
             client->rx_buff_len = rx_buff_len;
-            if ((client->rx_buff = lwcell_mem_malloc(rx_buff_len)) == NULL) {
+            if ((client->rx_buff = LWCELL_MEM_MALLOC(rx_buff_len, LWCELL_MEM_TAG_MQTT)) == NULL) {
                 lwcell_buff_free(&client->tx_buff);
                 lwcell_mem_free_s((void**)&client);
             }
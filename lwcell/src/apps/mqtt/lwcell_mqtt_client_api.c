@@ -128,7 +128,7 @@ prv_mqtt_evt(lwcell_mqtt_client_p client, lwcell_mqtt_evt_t* evt) {
             payload_size = LWCELL_MEM_ALIGN(sizeof(*payload) * (payload_len + 1));
 
             size = buf_size + topic_size + payload_size;
-            if ((buf = lwcell_mem_malloc(size)) != NULL) {
+            if ((buf = LWCELL_MEM_MALLOC(size, LWCELL_MEM_TAG_MQTT)) != NULL) {
                 LWCELL_MEMSET(buf, 0x00, size);
                 buf->topic = (void*)((uint8_t*)buf + buf_size);
                 buf->payload = (void*)((uint8_t*)buf + buf_size + topic_size);
@@ -203,7 +203,7 @@ lwcell_mqtt_client_api_new(size_t tx_buff_len, size_t rx_buff_len) {
     lwcell_mqtt_client_api_p client;
 
     /* Allocate client memory */
-    if ((client = lwcell_mem_calloc(1, LWCELL_MEM_ALIGN(sizeof(*client)))) != NULL) {
+    if ((client = LWCELL_MEM_CALLOC(1, LWCELL_MEM_ALIGN(sizeof(*client)), LWCELL_MEM_TAG_MQTT)) != NULL) {
         /* Create MQTT raw client structure */
         if ((client->mc = lwcell_mqtt_client_new(tx_buff_len, rx_buff_len)) != NULL) {
             /* Create receive mbox queue */
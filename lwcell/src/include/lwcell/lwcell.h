@@ -64,6 +64,16 @@ uint8_t lwcell_device_is_present(void);
 
 uint8_t lwcell_delay(uint32_t ms);
 
+#if LWCELL_CFG_CMD_HANDLE || __DOXYGEN__
+lwcellr_t lwcell_cmd_cancel(lwcell_cmd_handle_t* h);
+#endif /* LWCELL_CFG_CMD_HANDLE || __DOXYGEN__ */
+
+#if LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+lwcellr_t lwcell_pipe_get_stats(lwcell_pipe_stats_t* stats);
+lwcellr_t lwcell_pipe_get_cmd_stats(size_t cmd, lwcell_pipe_cmd_stats_t* stats);
+void lwcell_pipe_reset_stats(void);
+#endif /* LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
+
 /**
  * \}
  */
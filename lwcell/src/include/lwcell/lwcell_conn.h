@@ -49,6 +49,11 @@ extern "C" {
 
 lwcellr_t lwcell_conn_start(lwcell_conn_p* conn, lwcell_conn_type_t type, const char* const host, lwcell_port_t port,
                           void* const arg, lwcell_evt_fn conn_evt_fn, const uint32_t blocking);
+#if LWCELL_CFG_CMD_HANDLE || __DOXYGEN__
+lwcellr_t lwcell_conn_start_with_handle(lwcell_conn_p* conn, lwcell_conn_type_t type, const char* const host,
+                                      lwcell_port_t port, void* const arg, lwcell_evt_fn conn_evt_fn,
+                                      lwcell_cmd_handle_t* h, const uint32_t blocking);
+#endif /* LWCELL_CFG_CMD_HANDLE || __DOXYGEN__ */
 lwcellr_t lwcell_conn_close(lwcell_conn_p conn, const uint32_t blocking);
 lwcellr_t lwcell_conn_send(lwcell_conn_p conn, const void* data, size_t btw, size_t* const bw, const uint32_t blocking);
 lwcellr_t lwcell_conn_sendto(lwcell_conn_p conn, const lwcell_ip_t* const ip, lwcell_port_t port, const void* data,
@@ -64,11 +69,31 @@ lwcell_conn_p lwcell_conn_get_from_evt(lwcell_evt_t* evt);
 lwcellr_t lwcell_conn_write(lwcell_conn_p conn, const void* data, size_t btw, uint8_t flush, size_t* const mem_available);
 lwcellr_t lwcell_conn_recved(lwcell_conn_p conn, lwcell_pbuf_p pbuf);
 size_t lwcell_conn_get_total_recved_count(lwcell_conn_p conn);
+#if LWCELL_CFG_CONN_STATS || __DOXYGEN__
+lwcellr_t lwcell_conn_get_stats(lwcell_conn_p conn, lwcell_conn_stats_t* stats);
+lwcellr_t lwcell_conn_reset_stats(lwcell_conn_p conn);
+#endif /* LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__
+lwcellr_t lwcell_conn_set_rx_manual_ack(lwcell_conn_p conn, uint8_t en);
+#endif /* LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__
+lwcellr_t lwcell_conn_set_write_auto_flush(lwcell_conn_p conn, uint32_t time, size_t size);
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+lwcellr_t lwcell_conn_set_server(uint8_t en, lwcell_port_t port, lwcell_evt_fn server_evt_fn, const uint32_t blocking);
+uint8_t lwcell_conn_is_server_active(void);
+#endif /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
 
 uint8_t lwcell_conn_get_remote_ip(lwcell_conn_p conn, lwcell_ip_t* ip);
 lwcell_port_t lwcell_conn_get_remote_port(lwcell_conn_p conn);
 lwcell_port_t lwcell_conn_get_local_port(lwcell_conn_p conn);
 
+#if LWCELL_CFG_CONN_TRANSPARENT || __DOXYGEN__
+lwcellr_t lwcell_conn_transparent_escape(const uint32_t blocking);
+lwcellr_t lwcell_conn_transparent_resume(const uint32_t blocking);
+uint8_t lwcell_conn_transparent_is_data_mode(void);
+#endif /* LWCELL_CFG_CONN_TRANSPARENT || __DOXYGEN__ */
+
 /**
  * \}
  */
@@ -154,6 +154,57 @@ lwcell_conn_p lwcell_evt_conn_poll_get_conn(lwcell_evt_t* cc);
  * \}
  */
 
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__
+
+/**
+ * \anchor          LWCELL_EVT_CONN_WRITABLE
+ * \name            Connection writable
+ * \brief           Event helper functions for \ref LWCELL_EVT_CONN_WRITABLE event
+ */
+
+lwcell_conn_p lwcell_evt_conn_writable_get_conn(lwcell_evt_t* cc);
+
+/**
+ * \}
+ */
+
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__ */
+
+#if LWCELL_CFG_CONN_STATS || __DOXYGEN__
+
+/**
+ * \anchor          LWCELL_EVT_CONN_STATS
+ * \name            Connection statistics
+ * \brief           Event helper functions for \ref LWCELL_EVT_CONN_STATS event
+ */
+
+lwcell_conn_p lwcell_evt_conn_stats_get_conn(lwcell_evt_t* cc);
+const lwcell_conn_stats_t* lwcell_evt_conn_stats_get_stats(lwcell_evt_t* cc);
+
+/**
+ * \}
+ */
+
+#endif /* LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
+
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+
+/**
+ * \anchor          LWCELL_EVT_SERVER
+ * \name            Server
+ * \brief           Event helper functions for \ref LWCELL_EVT_SERVER event
+ */
+
+lwcellr_t lwcell_evt_server_get_result(lwcell_evt_t* cc);
+uint8_t lwcell_evt_server_is_enable(lwcell_evt_t* cc);
+lwcell_port_t lwcell_evt_server_get_port(lwcell_evt_t* cc);
+
+/**
+ * \}
+ */
+
+#endif /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
+
 /**
  * \anchor          LWCELL_EVT_CONN_ERROR
  * \name            Connection error
@@ -195,6 +246,23 @@ lwcell_mem_t lwcell_evt_sms_recv_get_mem(lwcell_evt_t* cc);
  * \}
  */
 
+#if LWCELL_CFG_SMS_DIRECT || __DOXYGEN__
+
+/**
+ * \anchor          LWCELL_EVT_SMS_DELIVER
+ * \name            SMS delivered directly
+ * \brief           Event helper functions for \ref LWCELL_EVT_SMS_DELIVER event
+ */
+
+const lwcell_sms_entry_t* lwcell_evt_sms_deliver_get_entry(lwcell_evt_t* cc);
+lwcellr_t lwcell_evt_sms_deliver_get_ack_result(lwcell_evt_t* cc);
+
+/**
+ * \}
+ */
+
+#endif /* LWCELL_CFG_SMS_DIRECT || __DOXYGEN__ */
+
 /**
  * \anchor          LWCELL_EVT_SMS_READ
  * \name            SMS content read
@@ -221,6 +289,26 @@ size_t lwcell_evt_sms_send_get_pos(lwcell_evt_t* cc);
  * \}
  */
 
+#if LWCELL_CFG_SMS_BULK || __DOXYGEN__
+
+/**
+ * \anchor          LWCELL_EVT_SMS_BULK
+ * \name            SMS bulk
+ * \brief           Event helper functions for \ref LWCELL_EVT_SMS_BULK event
+ */
+
+lwcell_sms_bulk_t* lwcell_evt_sms_bulk_get_job(lwcell_evt_t* cc);
+size_t lwcell_evt_sms_bulk_get_index(lwcell_evt_t* cc);
+lwcellr_t lwcell_evt_sms_bulk_get_result(lwcell_evt_t* cc);
+size_t lwcell_evt_sms_bulk_get_pos(lwcell_evt_t* cc);
+uint8_t lwcell_evt_sms_bulk_is_done(lwcell_evt_t* cc);
+
+/**
+ * \}
+ */
+
+#endif /* LWCELL_CFG_SMS_BULK || __DOXYGEN__ */
+
 /**
  * \anchor          LWCELL_EVT_SMS_DELETE
  * \name            SMS delete
@@ -261,6 +349,35 @@ size_t lwcell_evt_operator_scan_get_length(lwcell_evt_t* cc);
  * \}
  */
 
+/**
+ * \anchor          LWCELL_EVT_OPERATOR_SCAN_ENTRY
+ * \name            Operator scan entry
+ * \brief           Event helper functions for \ref LWCELL_EVT_OPERATOR_SCAN_ENTRY event
+ */
+
+const lwcell_operator_t* lwcell_evt_operator_scan_entry_get_entry(lwcell_evt_t* cc);
+size_t lwcell_evt_operator_scan_entry_get_index(lwcell_evt_t* cc);
+
+/**
+ * \}
+ */
+
+#if LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+
+/**
+ * \anchor          LWCELL_EVT_PIPE_STATS
+ * \name            Pipeline statistics
+ * \brief           Event helper functions for \ref LWCELL_EVT_PIPE_STATS event
+ */
+
+const lwcell_pipe_stats_t* lwcell_evt_pipe_stats_get_stats(lwcell_evt_t* cc);
+
+/**
+ * \}
+ */
+
+#endif /* LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
+
 /**
  * \}
  */
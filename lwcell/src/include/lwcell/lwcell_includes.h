@@ -67,6 +67,9 @@
 #if LWCELL_CFG_USSD || __DOXYGEN__
 #include "lwcell/lwcell_ussd.h"
 #endif /* LWCELL_CFG_USSD || __DOXYGEN__ */
+#if LWCELL_CFG_DNS || __DOXYGEN__
+#include "lwcell/lwcell_dns.h"
+#endif /* LWCELL_CFG_DNS || __DOXYGEN__ */
 
 #ifdef __cplusplus
 extern "C" {
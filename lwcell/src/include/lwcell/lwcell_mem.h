@@ -67,6 +67,60 @@ void* lwcell_mem_calloc(size_t num, size_t size);
 void lwcell_mem_free(void* ptr);
 uint8_t lwcell_mem_free_s(void** ptr);
 
+#if LWCELL_CFG_MEM_STATIC || __DOXYGEN__
+extern const lwcell_mem_static_footprint_t lwcell_mem_static_footprint;
+#endif /* LWCELL_CFG_MEM_STATIC || __DOXYGEN__ */
+
+#if LWCELL_CFG_MEM_STATS || LWCELL_CFG_MEM_STATIC || __DOXYGEN__
+
+void* lwcell_mem_malloc_tag(size_t size, lwcell_mem_tag_t tag);
+void* lwcell_mem_realloc_tag(void* ptr, size_t size, lwcell_mem_tag_t tag);
+void* lwcell_mem_calloc_tag(size_t num, size_t size, lwcell_mem_tag_t tag);
+#if LWCELL_CFG_MEM_STATS || __DOXYGEN__
+uint8_t lwcell_mem_get_stats(lwcell_mem_stats_t* stats);
+void lwcell_mem_reset_stats(void);
+#endif /* LWCELL_CFG_MEM_STATS || __DOXYGEN__ */
+
+/**
+ * \brief           Allocate memory and account it to allocation tag
+ * \note            Maps to \ref lwcell_mem_malloc when \ref LWCELL_CFG_MEM_STATS and
+ *                  \ref LWCELL_CFG_MEM_STATIC are disabled
+ * \param[in]       size: Number of bytes to allocate
+ * \param[in]       tag: Allocation tag, member of \ref lwcell_mem_tag_t
+ * \hideinitializer
+ */
+#define LWCELL_MEM_MALLOC(size, tag)       lwcell_mem_malloc_tag((size), (tag))
+
+/**
+ * \brief           Reallocate memory and account it to allocation tag
+ * \note            Maps to \ref lwcell_mem_realloc when \ref LWCELL_CFG_MEM_STATS and
+ *                  \ref LWCELL_CFG_MEM_STATIC are disabled
+ * \param[in]       ptr: Pointer to current allocated memory
+ * \param[in]       size: Number of bytes to allocate on new memory
+ * \param[in]       tag: Allocation tag, member of \ref lwcell_mem_tag_t
+ * \hideinitializer
+ */
+#define LWCELL_MEM_REALLOC(ptr, size, tag) lwcell_mem_realloc_tag((ptr), (size), (tag))
+
+/**
+ * \brief           Allocate memory, set it to zero and account it to allocation tag
+ * \note            Maps to \ref lwcell_mem_calloc when \ref LWCELL_CFG_MEM_STATS and
+ *                  \ref LWCELL_CFG_MEM_STATIC are disabled
+ * \param[in]       num: Number of elements to allocate
+ * \param[in]       size: Size of each element
+ * \param[in]       tag: Allocation tag, member of \ref lwcell_mem_tag_t
+ * \hideinitializer
+ */
+#define LWCELL_MEM_CALLOC(num, size, tag)  lwcell_mem_calloc_tag((num), (size), (tag))
+
+#else /* LWCELL_CFG_MEM_STATS || LWCELL_CFG_MEM_STATIC || __DOXYGEN__ */
+
+#define LWCELL_MEM_MALLOC(size, tag)       lwcell_mem_malloc(size)
+#define LWCELL_MEM_REALLOC(ptr, size, tag) lwcell_mem_realloc((ptr), (size))
+#define LWCELL_MEM_CALLOC(num, size, tag)  lwcell_mem_calloc((num), (size))
+
+#endif /* !(LWCELL_CFG_MEM_STATS || LWCELL_CFG_MEM_STATIC || __DOXYGEN__) */
+
 /**
  * \}
  */
@@ -63,6 +63,25 @@ typedef struct lwcell_netconn* lwcell_netconn_p;
 /* Immediate flush for TCP write. Used with \ref lwcell_netconn_write_ex*/
 #define LWCELL_NETCONN_FLAG_FLUSH      ((uint16_t)0x0001) /*!< Immediate flush after netconn write */
 
+#if LWCELL_CFG_NETCONN_POLL || __DOXYGEN__
+
+/* Events used with \ref lwcell_netconn_poll */
+#define LWCELL_NETCONN_POLL_READ   ((uint8_t)0x01) /*!< Data received, connection accepted or closed, read will not block */
+#define LWCELL_NETCONN_POLL_WRITE  ((uint8_t)0x02) /*!< Connection is active and data may be written */
+#define LWCELL_NETCONN_POLL_CLOSED ((uint8_t)0x04) /*!< Connection is closed. Always reported, even if not requested */
+
+/**
+ * \brief           Netconn poll entry
+ */
+typedef struct {
+    lwcell_netconn_p nc; /*!< Netconn handle to check */
+    uint8_t events;      /*!< Requested events, bitwise-ORed \ref LWCELL_NETCONN_POLL_READ and
+                                \ref LWCELL_NETCONN_POLL_WRITE flags */
+    uint8_t revents;     /*!< Events ready on netconn, set by \ref lwcell_netconn_poll */
+} lwcell_netconn_poll_t;
+
+#endif /* LWCELL_CFG_NETCONN_POLL || __DOXYGEN__ */
+
 /**
  * \brief           Netconn connection type
  */
@@ -75,11 +94,21 @@ typedef enum {
 lwcell_netconn_p lwcell_netconn_new(lwcell_netconn_type_t type);
 lwcellr_t lwcell_netconn_delete(lwcell_netconn_p nc);
 lwcellr_t lwcell_netconn_connect(lwcell_netconn_p nc, const char* host, lwcell_port_t port);
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+lwcellr_t lwcell_netconn_bind(lwcell_netconn_p nc, lwcell_port_t port);
+lwcellr_t lwcell_netconn_listen(lwcell_netconn_p nc);
+lwcellr_t lwcell_netconn_set_listen_conn_timeout(lwcell_netconn_p nc, uint16_t timeout);
+lwcellr_t lwcell_netconn_accept(lwcell_netconn_p nc, lwcell_netconn_p* client);
+#endif /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
 lwcellr_t lwcell_netconn_receive(lwcell_netconn_p nc, lwcell_pbuf_p* pbuf);
+lwcellr_t lwcell_netconn_receive_batch(lwcell_netconn_p nc, lwcell_pbuf_p* pbuf, size_t min_len, uint32_t timeout);
 lwcellr_t lwcell_netconn_close(lwcell_netconn_p nc);
 int8_t lwcell_netconn_getconnnum(lwcell_netconn_p nc);
 void lwcell_netconn_set_receive_timeout(lwcell_netconn_p nc, uint32_t timeout);
 uint32_t lwcell_netconn_get_receive_timeout(lwcell_netconn_p nc);
+#if LWCELL_CFG_NETCONN_POLL || __DOXYGEN__
+lwcellr_t lwcell_netconn_poll(lwcell_netconn_poll_t* set, size_t n, uint32_t timeout, size_t* ready);
+#endif /* LWCELL_CFG_NETCONN_POLL || __DOXYGEN__ */
 
 /* TCP only */
 lwcellr_t lwcell_netconn_write(lwcell_netconn_p nc, const void* data, size_t btw);
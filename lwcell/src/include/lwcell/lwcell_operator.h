@@ -55,6 +55,12 @@ lwcellr_t lwcell_operator_set(lwcell_operator_mode_t mode, lwcell_operator_forma
 
 lwcellr_t lwcell_operator_scan(lwcell_operator_t* ops, size_t opsl, size_t* opf, const lwcell_api_cmd_evt_fn evt_fn,
                                void* const evt_arg, const uint32_t blocking);
+#if LWCELL_CFG_CMD_HANDLE || __DOXYGEN__
+lwcellr_t lwcell_operator_scan_with_handle(lwcell_operator_t* ops, size_t opsl, size_t* opf, lwcell_cmd_handle_t* h,
+                                           const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg,
+                                           const uint32_t blocking);
+#endif /* LWCELL_CFG_CMD_HANDLE || __DOXYGEN__ */
+lwcellr_t lwcell_operator_scan_cancel(void);
 
 /**
  * \}
@@ -96,6 +96,211 @@
 #define LWCELL_CFG_MEM_ALIGNMENT 4
 #endif
 
+/**
+ * \brief           Enables `1` or disables `0` two-level segregated fit allocator
+ *
+ * When disabled, built-in allocator uses first-fit search over single address-ordered free list,
+ * where allocation time grows with number of free blocks (fragmentation).
+ *
+ * When enabled, free blocks are kept in segregated lists with bitmaps,
+ * giving allocation and free time independent on heap state.
+ * Regions are assigned with \ref lwcell_mem_assignmemory in the same way.
+ *
+ * \note            It uses more static RAM for list heads and one additional pointer per allocated block.
+ *                  Largest single block is limited to `16 MB`
+ * \note            Used only when \ref LWCELL_CFG_MEM_CUSTOM is disabled
+ */
+#ifndef LWCELL_CFG_MEM_TLSF
+#define LWCELL_CFG_MEM_TLSF 0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` tagged memory statistics
+ *
+ * When enabled, every allocated block remembers tag of subsystem that allocated it
+ * (packet buffers, messages, connection buffers, timeouts, netconn, MQTT) and
+ * current bytes, peak bytes, allocation and failure counts are kept per tag.
+ * Use \ref lwcell_mem_get_stats to read them, together with largest free block.
+ *
+ * \note            Used only when \ref LWCELL_CFG_MEM_CUSTOM is disabled
+ * \sa              lwcell_mem_get_stats, lwcell_mem_reset_stats
+ */
+#ifndef LWCELL_CFG_MEM_STATS
+#define LWCELL_CFG_MEM_STATS 0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` fully static allocation mode
+ *
+ * When enabled, there is no heap. Every allocation tag (see \ref lwcell_mem_tag_t)
+ * gets its own pool of fixed-size entries in statically allocated memory,
+ * sized at compile time with `LWCELL_CFG_MEM_STATIC_*` options.
+ * Allocation and free take constant time and fail with `NULL` (\ref lwcellERRMEM for API functions)
+ * when pool of the tag is exhausted or requested size is larger than pool entry.
+ *
+ * Entry sizes for messages, timeouts, connection write buffers and netconn objects
+ * are calculated automatically. Packet buffers should use \ref LWCELL_CFG_PBUF_POOL,
+ * with `PBUF` tag pool used as their fallback.
+ *
+ * Total static memory for given configuration is available in \ref lwcell_mem_static_footprint constant.
+ *
+ * \note            Memory for system port (threads, message queues) is not covered
+ *                  and must be provided by system port implementation
+ * \note            Used only when \ref LWCELL_CFG_MEM_CUSTOM and \ref LWCELL_CFG_MEM_TLSF are disabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC
+#define LWCELL_CFG_MEM_STATIC 0
+#endif
+
+/**
+ * \brief           Number of message entries in static allocation mode
+ * \note            Used only when \ref LWCELL_CFG_MEM_STATIC is enabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC_MSG_CNT
+#define LWCELL_CFG_MEM_STATIC_MSG_CNT 16
+#endif
+
+/**
+ * \brief           Number of timeout entries in static allocation mode
+ * \note            Used only when \ref LWCELL_CFG_MEM_STATIC is enabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC_TIMEOUT_CNT
+#define LWCELL_CFG_MEM_STATIC_TIMEOUT_CNT 16
+#endif
+
+/**
+ * \brief           Number of connection write buffers of \ref LWCELL_CFG_CONN_MAX_DATA_LEN bytes in static allocation mode
+ * \note            Used only when \ref LWCELL_CFG_MEM_STATIC and \ref LWCELL_CFG_CONN are enabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC_CONN_BUFF_CNT
+#define LWCELL_CFG_MEM_STATIC_CONN_BUFF_CNT LWCELL_CFG_MAX_CONNS
+#endif
+
+/**
+ * \brief           Number of netconn objects in static allocation mode
+ * \note            Used only when \ref LWCELL_CFG_MEM_STATIC and \ref LWCELL_CFG_NETCONN are enabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC_NETCONN_CNT
+#define LWCELL_CFG_MEM_STATIC_NETCONN_CNT LWCELL_CFG_MAX_CONNS
+#endif
+
+/**
+ * \brief           Size of packet buffer entry in static allocation mode, including packet buffer header
+ *
+ * These entries are only used when packet buffer pools are disabled or exhausted
+ *
+ * \note            Used only when \ref LWCELL_CFG_MEM_STATIC is enabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC_PBUF_SIZE
+#define LWCELL_CFG_MEM_STATIC_PBUF_SIZE (LWCELL_CFG_CONN_MAX_DATA_LEN + 64)
+#endif
+
+/**
+ * \brief           Number of packet buffer entries in static allocation mode
+ * \note            Used only when \ref LWCELL_CFG_MEM_STATIC is enabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC_PBUF_CNT
+#define LWCELL_CFG_MEM_STATIC_PBUF_CNT 4
+#endif
+
+/**
+ * \brief           Size of MQTT entry in static allocation mode
+ *
+ * It must be large enough for MQTT client object and for each of its buffers,
+ * as well as for buffers of received publish messages with MQTT client API.
+ *
+ * \note            Used only when \ref LWCELL_CFG_MEM_STATIC is enabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC_MQTT_SIZE
+#define LWCELL_CFG_MEM_STATIC_MQTT_SIZE 512
+#endif
+
+/**
+ * \brief           Number of MQTT entries in static allocation mode
+ * \note            Used only when \ref LWCELL_CFG_MEM_STATIC is enabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC_MQTT_CNT
+#define LWCELL_CFG_MEM_STATIC_MQTT_CNT 0
+#endif
+
+/**
+ * \brief           Size of entry for untagged allocations in static allocation mode
+ *
+ * Used for receive buffer of \ref LWCELL_CFG_RCV_BUFF_SIZE bytes and registered event functions.
+ *
+ * \note            Used only when \ref LWCELL_CFG_MEM_STATIC is enabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC_OTHER_SIZE
+#define LWCELL_CFG_MEM_STATIC_OTHER_SIZE LWCELL_CFG_RCV_BUFF_SIZE
+#endif
+
+/**
+ * \brief           Number of entries for untagged allocations in static allocation mode
+ * \note            Used only when \ref LWCELL_CFG_MEM_STATIC is enabled
+ */
+#ifndef LWCELL_CFG_MEM_STATIC_OTHER_CNT
+#define LWCELL_CFG_MEM_STATIC_OTHER_CNT 4
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` fixed-size pools for packet buffers
+ *
+ * When enabled, \ref lwcell_pbuf_new takes packet buffer from the smallest pool
+ * with large enough entries in constant time. Dynamic allocation is only used
+ * when all suitable pools are exhausted or requested length is larger than pool entry size.
+ *
+ * Memory for pools is statically allocated at compile time.
+ * Set entries count to `0` to disable specific pool.
+ *
+ * \note            Pool entry sizes must be in ascending order
+ * \sa              lwcell_pbuf_pool_get_stats
+ */
+#ifndef LWCELL_CFG_PBUF_POOL
+#define LWCELL_CFG_PBUF_POOL 0
+#endif
+
+/**
+ * \brief           Payload size in units of bytes for entries of first (smallest) packet buffer pool
+ */
+#ifndef LWCELL_CFG_PBUF_POOL_1_SIZE
+#define LWCELL_CFG_PBUF_POOL_1_SIZE 128
+#endif
+
+/**
+ * \brief           Number of entries in first packet buffer pool
+ */
+#ifndef LWCELL_CFG_PBUF_POOL_1_CNT
+#define LWCELL_CFG_PBUF_POOL_1_CNT 8
+#endif
+
+/**
+ * \brief           Payload size in units of bytes for entries of second packet buffer pool
+ */
+#ifndef LWCELL_CFG_PBUF_POOL_2_SIZE
+#define LWCELL_CFG_PBUF_POOL_2_SIZE 512
+#endif
+
+/**
+ * \brief           Number of entries in second packet buffer pool
+ */
+#ifndef LWCELL_CFG_PBUF_POOL_2_CNT
+#define LWCELL_CFG_PBUF_POOL_2_CNT 4
+#endif
+
+/**
+ * \brief           Payload size in units of bytes for entries of third (largest) packet buffer pool
+ */
+#ifndef LWCELL_CFG_PBUF_POOL_3_SIZE
+#define LWCELL_CFG_PBUF_POOL_3_SIZE LWCELL_CFG_CONN_MAX_DATA_LEN
+#endif
+
+/**
+ * \brief           Number of entries in third packet buffer pool
+ */
+#ifndef LWCELL_CFG_PBUF_POOL_3_CNT
+#define LWCELL_CFG_PBUF_POOL_3_CNT 4
+#endif
+
 /**
  * \brief           Enables `1` or disables `0` callback function and custom parameter for API functions
  *
@@ -106,6 +311,127 @@
 #define LWCELL_CFG_USE_API_FUNC_EVT 1
 #endif
 
+/**
+ * \brief           Enables `1` or disables `0` command handles
+ *
+ * When enabled, long running commands get `_with_handle` API variant, such as
+ * \ref lwcell_operator_scan_with_handle, \ref lwcell_sms_send_with_handle and \ref lwcell_conn_start_with_handle.
+ * Handle passed to it may set command deadline and cancel command with \ref lwcell_cmd_cancel.
+ * Blocking caller returns on deadline or cancel even when command still waits in queue.
+ * Callback of non-blocking command is called when command is taken from queue.
+ */
+#ifndef LWCELL_CFG_CMD_HANDLE
+#define LWCELL_CFG_CMD_HANDLE 0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` recording of command completion latency
+ *
+ * Producer thread keeps running percentile estimate of latency for every command type.
+ */
+#ifndef LWCELL_CFG_CMD_LATENCY
+#define LWCELL_CFG_CMD_LATENCY 0
+#endif
+
+/**
+ * \brief           Percentile of command latency to estimate, between `1` and `99`
+ *
+ * \note            Used only when \ref LWCELL_CFG_CMD_LATENCY is enabled
+ */
+#ifndef LWCELL_CFG_CMD_LATENCY_PERCENTILE
+#define LWCELL_CFG_CMD_LATENCY_PERCENTILE 95
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` command timeouts derived from observed latency
+ *
+ * Once enough samples are recorded, command timeout is set to latency estimate
+ * multiplied by \ref LWCELL_CFG_CMD_TIMEOUT_ADAPT_MULT and limited to
+ * \ref LWCELL_CFG_CMD_TIMEOUT_ADAPT_MIN and \ref LWCELL_CFG_CMD_TIMEOUT_ADAPT_MAX range.
+ * It replaces fixed timeout of API function, except for deadline set with command handle
+ * and for commands which timeout scales with amount of work, such as multi-part SMS
+ * or phonebook mirror load. Only commands finished with `OK` are recorded.
+ * When command times out, its samples are discarded and fixed timeout is used until learned again.
+ *
+ * \note            Used only when \ref LWCELL_CFG_CMD_LATENCY is enabled
+ */
+#ifndef LWCELL_CFG_CMD_TIMEOUT_ADAPT
+#define LWCELL_CFG_CMD_TIMEOUT_ADAPT 0
+#endif
+
+/**
+ * \brief           Multiplier applied to latency estimate to get command timeout
+ *
+ * \note            Used only when \ref LWCELL_CFG_CMD_TIMEOUT_ADAPT is enabled
+ */
+#ifndef LWCELL_CFG_CMD_TIMEOUT_ADAPT_MULT
+#define LWCELL_CFG_CMD_TIMEOUT_ADAPT_MULT 4
+#endif
+
+/**
+ * \brief           Minimal adapted command timeout in units of milliseconds
+ *
+ * \note            Used only when \ref LWCELL_CFG_CMD_TIMEOUT_ADAPT is enabled
+ */
+#ifndef LWCELL_CFG_CMD_TIMEOUT_ADAPT_MIN
+#define LWCELL_CFG_CMD_TIMEOUT_ADAPT_MIN 2000
+#endif
+
+/**
+ * \brief           Maximal adapted command timeout in units of milliseconds
+ *
+ * \note            Used only when \ref LWCELL_CFG_CMD_TIMEOUT_ADAPT is enabled
+ */
+#ifndef LWCELL_CFG_CMD_TIMEOUT_ADAPT_MAX
+#define LWCELL_CFG_CMD_TIMEOUT_ADAPT_MAX 180000
+#endif
+
+/**
+ * \brief           Number of latency samples of command type required before its timeout is adapted
+ *
+ * \note            Used only when \ref LWCELL_CFG_CMD_TIMEOUT_ADAPT is enabled
+ */
+#ifndef LWCELL_CFG_CMD_TIMEOUT_ADAPT_SAMPLES
+#define LWCELL_CFG_CMD_TIMEOUT_ADAPT_SAMPLES 8
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` command pipeline statistics
+ *
+ * For every command type, stack records time spent in producer queue,
+ * time from command start to first received byte and time from command start to its completion.
+ * Core lock hold time, producer queue and input buffer high-watermarks are recorded too.
+ *
+ * \note            Histograms take `3 * (2 * LWCELL_CFG_PIPE_STATS_BUCKETS + 4)` bytes of RAM per command type
+ * \sa              lwcell_pipe_get_stats, lwcell_pipe_get_cmd_stats
+ */
+#ifndef LWCELL_CFG_PIPE_STATS
+#define LWCELL_CFG_PIPE_STATS 0
+#endif
+
+/**
+ * \brief           Number of buckets in pipeline statistics histogram
+ *
+ * Bucket `0` counts samples below `1` ms, bucket `i` counts samples
+ * from `4^(i - 1)` to `4^i - 1` ms. Last bucket counts all longer samples too.
+ *
+ * \note            Used only when \ref LWCELL_CFG_PIPE_STATS is enabled
+ */
+#ifndef LWCELL_CFG_PIPE_STATS_BUCKETS
+#define LWCELL_CFG_PIPE_STATS_BUCKETS 8
+#endif
+
+/**
+ * \brief           Interval of \ref LWCELL_EVT_PIPE_STATS event in units of milliseconds
+ *
+ * Set to `0` to disable periodic event. Statistics are still available with \ref lwcell_pipe_get_stats
+ *
+ * \note            Used only when \ref LWCELL_CFG_PIPE_STATS is enabled
+ */
+#ifndef LWCELL_CFG_PIPE_STATS_EVT_INTERVAL
+#define LWCELL_CFG_PIPE_STATS_EVT_INTERVAL 0
+#endif
+
 /**
  * \defgroup        LWCELL_OPT_CONN Connection settings
  * \brief           Connection settings
@@ -152,6 +478,203 @@
 #define LWCELL_CFG_MAX_SEND_RETRIES 3
 #endif
 
+/**
+ * \brief           Enables `1` or disables `0` transparent data mode (`AT+CIPMODE=1`)
+ *
+ * When enabled, device operates in single connection mode (`AT+CIPMUX=0`).
+ * Once connection is active, AT port is switched to raw data mode
+ * and data are streamed directly over low-level functions, without `AT+CIPSEND` framing.
+ *
+ * Use \ref lwcell_conn_transparent_escape to return to command mode
+ * and \ref lwcell_conn_transparent_resume to continue with data mode.
+ *
+ * \note            Only one connection can be active at a time when this mode is enabled
+ * \note            Remote close is detected by `\r\nCLOSED\r\n` sequence in data stream.
+ *                  Sequence is removed from received data. Device sends it in-band,
+ *                  data that contain the same sequence are therefore seen as remote close too
+ */
+#ifndef LWCELL_CFG_CONN_TRANSPARENT
+#define LWCELL_CFG_CONN_TRANSPARENT 0
+#endif
+
+/**
+ * \brief           Guard time in units of milliseconds for `+++` escape sequence
+ *
+ * No data must be sent to device for this time before escape sequence
+ * is sent, to return from transparent data mode to command mode
+ *
+ * \note            Used only when \ref LWCELL_CFG_CONN_TRANSPARENT is enabled
+ */
+#ifndef LWCELL_CFG_CONN_TRANSPARENT_GUARD_TIME
+#define LWCELL_CFG_CONN_TRANSPARENT_GUARD_TIME 1000
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` manual receive mode (`AT+CIPRXGET=1`)
+ *
+ * When enabled, device keeps received data in its internal buffer and only notifies stack about it.
+ * Stack reads data in chunks, sized to available memory and to connection receive window.
+ * When application does not consume data, device buffer fills up and TCP flow control
+ * slows down remote side, instead of data being dropped by the stack.
+ *
+ * By default, received data are confirmed automatically when connection callback returns.
+ * Application, which keeps received buffers after callback returns, enables manual confirmation
+ * per connection with \ref lwcell_conn_set_rx_manual_ack.
+ *
+ * \note            When manual confirmation is enabled, application must call \ref lwcell_conn_recved
+ *                  once received data are processed, otherwise connection stops receiving
+ *                  after \ref LWCELL_CFG_CONN_MANUAL_RX_WINDOW bytes. Netconn API enables and handles it automatically
+ */
+#ifndef LWCELL_CFG_CONN_MANUAL_RX
+#define LWCELL_CFG_CONN_MANUAL_RX 0
+#endif
+
+/**
+ * \brief           Receive window in units of bytes for manual receive mode
+ *
+ * Maximal number of bytes sent to application for single connection,
+ * that have not yet been confirmed with \ref lwcell_conn_recved.
+ * Applies only to connections with manual confirmation, see \ref lwcell_conn_set_rx_manual_ack
+ *
+ * \note            Used only when \ref LWCELL_CFG_CONN_MANUAL_RX is enabled
+ */
+#ifndef LWCELL_CFG_CONN_MANUAL_RX_WINDOW
+#define LWCELL_CFG_CONN_MANUAL_RX_WINDOW (4 * LWCELL_CFG_CONN_MAX_DATA_LEN)
+#endif
+
+/**
+ * \brief           Time in units of milliseconds to retry reading data
+ *                  when there was no memory for packet buffer
+ *
+ * \note            Used only when \ref LWCELL_CFG_CONN_MANUAL_RX is enabled
+ */
+#ifndef LWCELL_CFG_CONN_MANUAL_RX_RETRY_TIME
+#define LWCELL_CFG_CONN_MANUAL_RX_RETRY_TIME 100
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` coalescing of small send requests
+ *
+ * When enabled, small TCP send requests queued on the same connection
+ * while previous request is still waiting in producer queue
+ * are merged to single `AT+CIPSEND` command, up to \ref LWCELL_CFG_CONN_MAX_DATA_LEN bytes.
+ *
+ * Every send request still gets its own \ref LWCELL_EVT_CONN_SEND event and written bytes report.
+ * UDP connections are never coalesced to keep datagram boundaries.
+ *
+ * \note            Not available when \ref LWCELL_CFG_CONN_TRANSPARENT is enabled
+ */
+#ifndef LWCELL_CFG_CONN_TX_COALESCE
+#define LWCELL_CFG_CONN_TX_COALESCE 0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` automatic flush of connection write buffer
+ *
+ * When enabled, data written with \ref lwcell_conn_write are sent automatically
+ * when buffer reaches size threshold or when delay since first byte in buffer expires.
+ * \ref LWCELL_EVT_CONN_WRITABLE event is sent when memory becomes available
+ * after \ref lwcell_conn_write could not allocate new write buffer,
+ * when any connection finishes sending or at latest after \ref LWCELL_CFG_CONN_POLL_INTERVAL.
+ *
+ * Threshold and delay can be changed per connection with \ref lwcell_conn_set_write_auto_flush
+ */
+#ifndef LWCELL_CFG_CONN_WRITE_AUTO_FLUSH
+#define LWCELL_CFG_CONN_WRITE_AUTO_FLUSH 0
+#endif
+
+/**
+ * \brief           Default delay in units of milliseconds after first byte in write buffer,
+ *                  before buffer is automatically sent
+ *
+ * Set to `0` to disable time based flush
+ *
+ * \note            Used only when \ref LWCELL_CFG_CONN_WRITE_AUTO_FLUSH is enabled
+ */
+#ifndef LWCELL_CFG_CONN_WRITE_AUTO_FLUSH_TIME
+#define LWCELL_CFG_CONN_WRITE_AUTO_FLUSH_TIME 20
+#endif
+
+/**
+ * \brief           Default number of bytes in write buffer to immediately send it
+ *
+ * Set to `0` to send buffer only when full or when delay expires
+ *
+ * \note            Used only when \ref LWCELL_CFG_CONN_WRITE_AUTO_FLUSH is enabled
+ */
+#ifndef LWCELL_CFG_CONN_WRITE_AUTO_FLUSH_SIZE
+#define LWCELL_CFG_CONN_WRITE_AUTO_FLUSH_SIZE (LWCELL_CFG_CONN_MAX_DATA_LEN / 2)
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` TCP server mode with `AT+CIPSERVER` command
+ *
+ * When enabled, device may listen on local port and accept incoming connections,
+ * up to \ref LWCELL_CFG_MAX_CONNS concurrently, see \ref lwcell_conn_set_server
+ *
+ * \note            Not available when \ref LWCELL_CFG_CONN_TRANSPARENT is enabled
+ */
+#ifndef LWCELL_CFG_CONN_SERVER
+#define LWCELL_CFG_CONN_SERVER 0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` adaptive send chunk size
+ *
+ * When enabled, maximal data length per `AT+CIPSEND` is queried with `AT+CIPSEND?`
+ * after connection is established and is used instead of \ref LWCELL_CFG_CONN_MAX_DATA_LEN.
+ * Chunk size is then decreased on `SEND FAIL` or slow `SEND OK` response,
+ * and increased back up to device maximum on fast `SEND OK` responses
+ *
+ * \note            Not available when \ref LWCELL_CFG_CONN_TRANSPARENT is enabled
+ */
+#ifndef LWCELL_CFG_CONN_ADAPTIVE_SEND
+#define LWCELL_CFG_CONN_ADAPTIVE_SEND 0
+#endif
+
+/**
+ * \brief           Minimal chunk size in bytes adaptive send may decrease to
+ *
+ * \note            Used only when \ref LWCELL_CFG_CONN_ADAPTIVE_SEND is enabled
+ */
+#ifndef LWCELL_CFG_CONN_ADAPTIVE_SEND_MIN_LEN
+#define LWCELL_CFG_CONN_ADAPTIVE_SEND_MIN_LEN 128
+#endif
+
+/**
+ * \brief           Time in units of milliseconds between `AT+CIPSEND` and `SEND OK`
+ *                  above which chunk size is decreased
+ *
+ * Faster responses for full chunks increase chunk size
+ *
+ * \note            Used only when \ref LWCELL_CFG_CONN_ADAPTIVE_SEND is enabled
+ */
+#ifndef LWCELL_CFG_CONN_ADAPTIVE_SEND_LATENCY
+#define LWCELL_CFG_CONN_ADAPTIVE_SEND_LATENCY 1000
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` per connection transport statistics
+ *
+ * When enabled, each connection counts sent and received data, send latencies and failures.
+ * Statistics are available with \ref lwcell_conn_get_stats function
+ */
+#ifndef LWCELL_CFG_CONN_STATS
+#define LWCELL_CFG_CONN_STATS 0
+#endif
+
+/**
+ * \brief           Interval in units of milliseconds for \ref LWCELL_EVT_CONN_STATS event
+ *
+ * Event is sent to connection callback function with current statistics.
+ * Interval is rounded up to \ref LWCELL_CFG_CONN_POLL_INTERVAL. Set to `0` to disable the event
+ *
+ * \note            Used only when \ref LWCELL_CFG_CONN_STATS is enabled
+ */
+#ifndef LWCELL_CFG_CONN_STATS_EVT_INTERVAL
+#define LWCELL_CFG_CONN_STATS_EVT_INTERVAL 0
+#endif
+
 /**
  * \}
  */
@@ -214,6 +737,21 @@
 #define LWCELL_CFG_RESET_DELAY_AFTER 5000
 #endif
 
+/**
+ * \brief           Enables `1` or disables `0` shadow of modem-side settings
+ *
+ * Stack keeps track of SMS message format, preferred SMS storages and phonebook storage,
+ * last successfully set on device. Mode-setting sub-commands (`AT+CMGF`, `AT+CPMS`, `AT+CPBS`)
+ * are skipped when device already holds requested state.
+ *
+ * Shadow is invalidated on reset, on device boot notification and on failed set command.
+ *
+ * \note            Storage usage counters are not refreshed when `AT+CPMS` or `AT+CPBS` command is skipped
+ */
+#ifndef LWCELL_CFG_MODEM_SHADOW
+#define LWCELL_CFG_MODEM_SHADOW 0
+#endif
+
 /**
  * \brief           Enables `1` or disables `0` periodic keep-alive events to registered callbacks
  *
@@ -514,6 +1052,8 @@
  * \brief           Accept queue length for new client when netconn server is used
  *
  * Defines number of maximal clients waiting in accept queue of server connection
+ *
+ * \note            Used only when \ref LWCELL_CFG_CONN_SERVER is enabled
  */
 #ifndef LWCELL_CFG_NETCONN_ACCEPT_QUEUE_LEN
 #define LWCELL_CFG_NETCONN_ACCEPT_QUEUE_LEN 5
@@ -528,6 +1068,16 @@
 #define LWCELL_CFG_NETCONN_RECEIVE_QUEUE_LEN 8
 #endif
 
+/**
+ * \brief           Enables `1` or disables `0` \ref lwcell_netconn_poll function
+ *
+ * When enabled, single thread may wait for data, new connection or close event
+ * on multiple netconns at the same time
+ */
+#ifndef LWCELL_CFG_NETCONN_POLL
+#define LWCELL_CFG_NETCONN_POLL 0
+#endif
+
 /**
  * \}
  */
@@ -614,6 +1164,81 @@
 #define LWCELL_CFG_SMS 0
 #endif
 
+/**
+ * \brief           Enables `1` or disables `0` PDU mode for SMS
+ *
+ * When enabled, \ref lwcell_sms_send_ex function is available to send GSM 7-bit, UCS2 or 8-bit data,
+ * split to concatenated parts when it does not fit single message.
+ *
+ * \ref lwcell_sms_read and \ref lwcell_sms_list read messages in PDU mode and decode them,
+ * text messages are reported in UTF-8 format, together with coding and concatenation information.
+ *
+ * \note            Used only when \ref LWCELL_CFG_SMS is enabled
+ */
+#ifndef LWCELL_CFG_SMS_PDU
+#define LWCELL_CFG_SMS_PDU 0
+#endif
+
+/**
+ * \brief           Maximal number of parts of concatenated message for \ref lwcell_sms_concat_t reassembly
+ *
+ * \note            Value must be between `1` and `32`
+ * \note            Used only when \ref LWCELL_CFG_SMS_PDU is enabled
+ */
+#ifndef LWCELL_CFG_SMS_CONCAT_MAX_PARTS
+#define LWCELL_CFG_SMS_CONCAT_MAX_PARTS 4
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` bulk SMS send jobs
+ *
+ * When enabled, \ref lwcell_sms_bulk_start function sends same text to list of recipients,
+ * with one `AT+CMGS` command per recipient, optional rate limit and retry of transient errors.
+ *
+ * \note            Used only when \ref LWCELL_CFG_SMS is enabled
+ */
+#ifndef LWCELL_CFG_SMS_BULK
+#define LWCELL_CFG_SMS_BULK 0
+#endif
+
+/**
+ * \brief           Maximal number of retries for single recipient of bulk SMS job
+ *
+ * Only transient `+CMS ERROR` codes (network congestion, temporary failure, network timeout) are retried.
+ *
+ * \note            Used only when \ref LWCELL_CFG_SMS_BULK is enabled
+ */
+#ifndef LWCELL_CFG_SMS_BULK_RETRIES
+#define LWCELL_CFG_SMS_BULK_RETRIES 3
+#endif
+
+/**
+ * \brief           Delay before first retry of bulk SMS recipient in units of milliseconds
+ *
+ * Delay is doubled on every next retry of the same recipient.
+ *
+ * \note            Used only when \ref LWCELL_CFG_SMS_BULK is enabled
+ */
+#ifndef LWCELL_CFG_SMS_BULK_BACKOFF
+#define LWCELL_CFG_SMS_BULK_BACKOFF 2000
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` direct SMS delivery with `+CMT` indications
+ *
+ * When enabled, \ref lwcell_sms_set_direct_delivery configures device to route new messages
+ * directly to the stack instead of storage, reported with \ref LWCELL_EVT_SMS_DELIVER event.
+ *
+ * Messages can be acknowledged with `AT+CNMA`, executed before commands waiting in queue.
+ * Acknowledge is still delayed by command in progress, such as connection start or operator scan.
+ * Device may disable direct delivery when acknowledge is late, network then resends the message.
+ *
+ * \note            Used only when \ref LWCELL_CFG_SMS is enabled
+ */
+#ifndef LWCELL_CFG_SMS_DIRECT
+#define LWCELL_CFG_SMS_DIRECT 0
+#endif
+
 /**
  * \brief           Enables `1` or disables `0` call API.
  *
@@ -630,6 +1255,41 @@
 #define LWCELL_CFG_PHONEBOOK 0
 #endif
 
+/**
+ * \brief           Enables `1` or disables `0` local RAM mirror of phonebook memory
+ *
+ * When enabled, \ref lwcell_pb_mirror_load reads all entries of selected memory
+ * and keeps them coherent with \ref lwcell_pb_add, \ref lwcell_pb_edit and \ref lwcell_pb_delete.
+ * Mirror is searched by number or name prefix without communication with device.
+ *
+ * \note            Used only when \ref LWCELL_CFG_PHONEBOOK is enabled
+ */
+#ifndef LWCELL_CFG_PHONEBOOK_MIRROR
+#define LWCELL_CFG_PHONEBOOK_MIRROR 0
+#endif
+
+/**
+ * \brief           Maximal number of phonebook entries kept in local mirror
+ *
+ * \note            Used only when \ref LWCELL_CFG_PHONEBOOK_MIRROR is enabled
+ */
+#ifndef LWCELL_CFG_PHONEBOOK_MIRROR_SIZE
+#define LWCELL_CFG_PHONEBOOK_MIRROR_SIZE 50
+#endif
+
+/**
+ * \brief           Number of trailing digits compared when searching local mirror by phone number
+ *
+ * Trailing digits match numbers stored in national format with numbers reported
+ * in international format, such as `041123456` and `+38641123456` when set to `8`.
+ * Set to `0` to compare all digits.
+ *
+ * \note            Used only when \ref LWCELL_CFG_PHONEBOOK_MIRROR is enabled
+ */
+#ifndef LWCELL_CFG_PHONEBOOK_MIRROR_NUM_DIGITS
+#define LWCELL_CFG_PHONEBOOK_MIRROR_NUM_DIGITS 8
+#endif
+
 /**
  * \brief           Enables `1` or disables `0` HTTP API.
  *
@@ -665,6 +1325,63 @@
 #define LWCELL_CFG_USSD 0
 #endif
 
+/**
+ * \brief           Enables `1` or disables `0` DNS API with resolved address cache.
+ *
+ * When enabled, \ref lwcell_conn_start resolves host names with `AT+CDNSGIP`
+ * and connects to cached IP address on next connection to the same host
+ *
+ * \note            \ref LWCELL_CFG_NETWORK must be enabled to use DNS feature
+ */
+#ifndef LWCELL_CFG_DNS
+#define LWCELL_CFG_DNS 0
+#endif
+
+/**
+ * \brief           Number of host names kept in DNS cache
+ *
+ * Least recently used entry is replaced when cache is full
+ *
+ * \note            Used only when \ref LWCELL_CFG_DNS is enabled
+ */
+#ifndef LWCELL_CFG_DNS_CACHE_SIZE
+#define LWCELL_CFG_DNS_CACHE_SIZE 4
+#endif
+
+/**
+ * \brief           Time in units of milliseconds resolved address is valid in DNS cache
+ *
+ * Device does not report record TTL, value is used for all entries
+ *
+ * \note            Used only when \ref LWCELL_CFG_DNS is enabled
+ */
+#ifndef LWCELL_CFG_DNS_CACHE_TTL
+#define LWCELL_CFG_DNS_CACHE_TTL 300000
+#endif
+
+/**
+ * \brief           Time in units of milliseconds before entry expires when it is resolved again in background
+ *
+ * Only entries used by application within last \ref LWCELL_CFG_DNS_CACHE_TTL period are refreshed.
+ * Value is also used as cache check interval
+ *
+ * \note            Used only when \ref LWCELL_CFG_DNS is enabled
+ */
+#ifndef LWCELL_CFG_DNS_CACHE_REFRESH_TIME
+#define LWCELL_CFG_DNS_CACHE_REFRESH_TIME 30000
+#endif
+
+/**
+ * \brief           Maximal length of host name in DNS cache, including `NULL` termination
+ *
+ * Longer host names are resolved by device on every connection
+ *
+ * \note            Used only when \ref LWCELL_CFG_DNS is enabled
+ */
+#ifndef LWCELL_CFG_DNS_HOST_MAX_LEN
+#define LWCELL_CFG_DNS_HOST_MAX_LEN 64
+#endif
+
 /**
  * \}
  */
@@ -744,6 +1461,112 @@ void *  my_memset(void* dst, int b, size_t len);
 #endif /* LWCELL_CFG_INPUT_USE_PROCESS */
 #endif /* !LWCELL_CFG_OS */
 
+#if LWCELL_CFG_CONN_TRANSPARENT && !LWCELL_CFG_CONN
+#error "LWCELL_CFG_CONN must be enabled to use LWCELL_CFG_CONN_TRANSPARENT!"
+#endif /* LWCELL_CFG_CONN_TRANSPARENT && !LWCELL_CFG_CONN */
+
+#if LWCELL_CFG_MEM_STATS && LWCELL_CFG_MEM_CUSTOM
+#error "LWCELL_CFG_MEM_STATS cannot be used together with LWCELL_CFG_MEM_CUSTOM!"
+#endif /* LWCELL_CFG_MEM_STATS && LWCELL_CFG_MEM_CUSTOM */
+
+#if LWCELL_CFG_MEM_STATIC && (LWCELL_CFG_MEM_CUSTOM || LWCELL_CFG_MEM_TLSF)
+#error "LWCELL_CFG_MEM_STATIC cannot be used together with LWCELL_CFG_MEM_CUSTOM or LWCELL_CFG_MEM_TLSF!"
+#endif /* LWCELL_CFG_MEM_STATIC && (LWCELL_CFG_MEM_CUSTOM || LWCELL_CFG_MEM_TLSF) */
+
+#if LWCELL_CFG_PBUF_POOL
+#if LWCELL_CFG_PBUF_POOL_1_SIZE > LWCELL_CFG_PBUF_POOL_2_SIZE || LWCELL_CFG_PBUF_POOL_2_SIZE > LWCELL_CFG_PBUF_POOL_3_SIZE
+#error "Packet buffer pool sizes must be in ascending order!"
+#endif /* LWCELL_CFG_PBUF_POOL_1_SIZE > LWCELL_CFG_PBUF_POOL_2_SIZE || ... */
+#endif /* LWCELL_CFG_PBUF_POOL */
+
+#if LWCELL_CFG_CONN_MANUAL_RX && !LWCELL_CFG_CONN
+#error "LWCELL_CFG_CONN must be enabled to use LWCELL_CFG_CONN_MANUAL_RX!"
+#endif /* LWCELL_CFG_CONN_MANUAL_RX && !LWCELL_CFG_CONN */
+
+#if LWCELL_CFG_CONN_MANUAL_RX && LWCELL_CFG_CONN_TRANSPARENT
+#error "LWCELL_CFG_CONN_MANUAL_RX cannot be used together with LWCELL_CFG_CONN_TRANSPARENT!"
+#endif /* LWCELL_CFG_CONN_MANUAL_RX && LWCELL_CFG_CONN_TRANSPARENT */
+
+#if LWCELL_CFG_CONN_TX_COALESCE && !LWCELL_CFG_CONN
+#error "LWCELL_CFG_CONN must be enabled to use LWCELL_CFG_CONN_TX_COALESCE!"
+#endif /* LWCELL_CFG_CONN_TX_COALESCE && !LWCELL_CFG_CONN */
+
+#if LWCELL_CFG_CONN_TX_COALESCE && LWCELL_CFG_CONN_TRANSPARENT
+#error "LWCELL_CFG_CONN_TX_COALESCE cannot be used together with LWCELL_CFG_CONN_TRANSPARENT!"
+#endif /* LWCELL_CFG_CONN_TX_COALESCE && LWCELL_CFG_CONN_TRANSPARENT */
+
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH && !LWCELL_CFG_CONN
+#error "LWCELL_CFG_CONN must be enabled to use LWCELL_CFG_CONN_WRITE_AUTO_FLUSH!"
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH && !LWCELL_CFG_CONN */
+
+#if LWCELL_CFG_CONN_SERVER && !LWCELL_CFG_CONN
+#error "LWCELL_CFG_CONN must be enabled to use LWCELL_CFG_CONN_SERVER!"
+#endif /* LWCELL_CFG_CONN_SERVER && !LWCELL_CFG_CONN */
+
+#if LWCELL_CFG_CONN_SERVER && LWCELL_CFG_CONN_TRANSPARENT
+#error "LWCELL_CFG_CONN_SERVER cannot be used together with LWCELL_CFG_CONN_TRANSPARENT!"
+#endif /* LWCELL_CFG_CONN_SERVER && LWCELL_CFG_CONN_TRANSPARENT */
+
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND && !LWCELL_CFG_CONN
+#error "LWCELL_CFG_CONN must be enabled to use LWCELL_CFG_CONN_ADAPTIVE_SEND!"
+#endif /* LWCELL_CFG_CONN_ADAPTIVE_SEND && !LWCELL_CFG_CONN */
+
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND && LWCELL_CFG_CONN_TRANSPARENT
+#error "LWCELL_CFG_CONN_ADAPTIVE_SEND cannot be used together with LWCELL_CFG_CONN_TRANSPARENT!"
+#endif /* LWCELL_CFG_CONN_ADAPTIVE_SEND && LWCELL_CFG_CONN_TRANSPARENT */
+
+#if LWCELL_CFG_CONN_STATS && !LWCELL_CFG_CONN
+#error "LWCELL_CFG_CONN must be enabled to use LWCELL_CFG_CONN_STATS!"
+#endif /* LWCELL_CFG_CONN_STATS && !LWCELL_CFG_CONN */
+
+#if LWCELL_CFG_SMS_PDU && !LWCELL_CFG_SMS
+#error "LWCELL_CFG_SMS must be enabled to use LWCELL_CFG_SMS_PDU!"
+#endif /* LWCELL_CFG_SMS_PDU && !LWCELL_CFG_SMS */
+
+#if LWCELL_CFG_SMS_PDU && (LWCELL_CFG_SMS_CONCAT_MAX_PARTS < 1 || LWCELL_CFG_SMS_CONCAT_MAX_PARTS > 32)
+#error "LWCELL_CFG_SMS_CONCAT_MAX_PARTS must be between 1 and 32!"
+#endif /* LWCELL_CFG_SMS_PDU && (LWCELL_CFG_SMS_CONCAT_MAX_PARTS < 1 || LWCELL_CFG_SMS_CONCAT_MAX_PARTS > 32) */
+
+#if LWCELL_CFG_SMS_DIRECT && !LWCELL_CFG_SMS
+#error "LWCELL_CFG_SMS must be enabled to use LWCELL_CFG_SMS_DIRECT!"
+#endif /* LWCELL_CFG_SMS_DIRECT && !LWCELL_CFG_SMS */
+
+#if LWCELL_CFG_SMS_BULK && !LWCELL_CFG_SMS
+#error "LWCELL_CFG_SMS must be enabled to use LWCELL_CFG_SMS_BULK!"
+#endif /* LWCELL_CFG_SMS_BULK && !LWCELL_CFG_SMS */
+
+#if LWCELL_CFG_CMD_TIMEOUT_ADAPT && !LWCELL_CFG_CMD_LATENCY
+#error "LWCELL_CFG_CMD_LATENCY must be enabled to use LWCELL_CFG_CMD_TIMEOUT_ADAPT!"
+#endif /* LWCELL_CFG_CMD_TIMEOUT_ADAPT && !LWCELL_CFG_CMD_LATENCY */
+
+#if LWCELL_CFG_CMD_LATENCY && (LWCELL_CFG_CMD_LATENCY_PERCENTILE < 1 || LWCELL_CFG_CMD_LATENCY_PERCENTILE > 99)
+#error "LWCELL_CFG_CMD_LATENCY_PERCENTILE must be between 1 and 99!"
+#endif /* LWCELL_CFG_CMD_LATENCY && (LWCELL_CFG_CMD_LATENCY_PERCENTILE < 1 || LWCELL_CFG_CMD_LATENCY_PERCENTILE > 99) */
+
+#if LWCELL_CFG_CMD_TIMEOUT_ADAPT && (LWCELL_CFG_CMD_TIMEOUT_ADAPT_MULT < 1 || LWCELL_CFG_CMD_TIMEOUT_ADAPT_MIN > LWCELL_CFG_CMD_TIMEOUT_ADAPT_MAX)
+#error "LWCELL_CFG_CMD_TIMEOUT_ADAPT_MULT must be at least 1 and LWCELL_CFG_CMD_TIMEOUT_ADAPT_MIN not above LWCELL_CFG_CMD_TIMEOUT_ADAPT_MAX!"
+#endif /* LWCELL_CFG_CMD_TIMEOUT_ADAPT && (LWCELL_CFG_CMD_TIMEOUT_ADAPT_MULT < 1 || LWCELL_CFG_CMD_TIMEOUT_ADAPT_MIN > LWCELL_CFG_CMD_TIMEOUT_ADAPT_MAX) */
+
+#if LWCELL_CFG_PIPE_STATS && (LWCELL_CFG_PIPE_STATS_BUCKETS < 2 || LWCELL_CFG_PIPE_STATS_BUCKETS > 16)
+#error "LWCELL_CFG_PIPE_STATS_BUCKETS must be between 2 and 16!"
+#endif /* LWCELL_CFG_PIPE_STATS && (LWCELL_CFG_PIPE_STATS_BUCKETS < 2 || LWCELL_CFG_PIPE_STATS_BUCKETS > 16) */
+
+#if LWCELL_CFG_PHONEBOOK_MIRROR && !LWCELL_CFG_PHONEBOOK
+#error "LWCELL_CFG_PHONEBOOK must be enabled to use LWCELL_CFG_PHONEBOOK_MIRROR!"
+#endif /* LWCELL_CFG_PHONEBOOK_MIRROR && !LWCELL_CFG_PHONEBOOK */
+
+#if LWCELL_CFG_PHONEBOOK_MIRROR && (LWCELL_CFG_PHONEBOOK_MIRROR_SIZE < 1 || LWCELL_CFG_PHONEBOOK_MIRROR_SIZE > 0xFFFF)
+#error "LWCELL_CFG_PHONEBOOK_MIRROR_SIZE must be between 1 and 65535!"
+#endif /* LWCELL_CFG_PHONEBOOK_MIRROR && (LWCELL_CFG_PHONEBOOK_MIRROR_SIZE < 1 || LWCELL_CFG_PHONEBOOK_MIRROR_SIZE > 0xFFFF) */
+
+#if LWCELL_CFG_DNS && !LWCELL_CFG_NETWORK
+#error "LWCELL_CFG_NETWORK must be enabled to use LWCELL_CFG_DNS!"
+#endif /* LWCELL_CFG_DNS && !LWCELL_CFG_NETWORK */
+
+#if LWCELL_CFG_DNS && LWCELL_CFG_DNS_CACHE_SIZE < 1
+#error "LWCELL_CFG_DNS_CACHE_SIZE must be at least 1!"
+#endif /* LWCELL_CFG_DNS && LWCELL_CFG_DNS_CACHE_SIZE < 1 */
+
 #endif /* !__DOXYGEN__ */
 
 #include "lwcell/lwcell_debug.h"
@@ -53,6 +53,12 @@ uint8_t lwcelli_parse_cmgs(const char* str, size_t* num);
 uint8_t lwcelli_parse_cmti(const char* str, uint8_t send_evt);
 uint8_t lwcelli_parse_cmgr(const char* str);
 uint8_t lwcelli_parse_cmgl(const char* str);
+#if LWCELL_CFG_SMS_DIRECT
+uint8_t lwcelli_parse_cmt(const char* str);
+#endif /* LWCELL_CFG_SMS_DIRECT */
+#if LWCELL_CFG_SMS_PDU
+uint8_t lwcelli_parse_sms_pdu(lwcell_sms_entry_t* e, uint8_t ch);
+#endif /* LWCELL_CFG_SMS_PDU */
 
 uint8_t lwcelli_parse_at_sdk_version(const char* str, uint32_t* version_out);
 
@@ -68,6 +74,10 @@ uint8_t lwcelli_parse_cpbf(const char* str);
 uint8_t lwcelli_parse_cipstatus_conn(const char* str, uint8_t is_conn_line, uint8_t* continueScan);
 
 uint8_t lwcelli_parse_ipd(const char* str);
+uint8_t lwcelli_parse_ciprxget(const char* str);
+uint8_t lwcelli_parse_cipsend_max(const char* str, uint8_t num);
+
+uint8_t lwcelli_parse_cdnsgip(const char* str, lwcell_ip_t* ip);
 
 #if defined(__cplusplus)
 }
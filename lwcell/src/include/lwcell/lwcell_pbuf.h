@@ -47,6 +47,15 @@ extern "C" {
  * \{
  */
 
+/**
+ * \brief           Pbuf chain segment iterator
+ * \note            Use it with \ref lwcell_pbuf_iter_init and \ref lwcell_pbuf_iter_next functions
+ */
+typedef struct {
+    lwcell_pbuf_p pbuf; /*!< Pbuf with next segment */
+    size_t off;         /*!< Start offset in next segment */
+} lwcell_pbuf_iter_t;
+
 lwcell_pbuf_p lwcell_pbuf_new(size_t len);
 size_t lwcell_pbuf_free(lwcell_pbuf_p pbuf);
 size_t lwcell_pbuf_free_s(lwcell_pbuf_p* pbuf);
@@ -70,9 +79,15 @@ uint8_t lwcell_pbuf_advance(lwcell_pbuf_p pbuf, int len);
 lwcell_pbuf_p lwcell_pbuf_skip(lwcell_pbuf_p pbuf, size_t offset, size_t* new_offset);
 
 void* lwcell_pbuf_get_linear_addr(const lwcell_pbuf_p pbuf, size_t offset, size_t* new_len);
+uint8_t lwcell_pbuf_iter_init(lwcell_pbuf_iter_t* it, const lwcell_pbuf_p pbuf, size_t offset);
+uint8_t lwcell_pbuf_iter_next(lwcell_pbuf_iter_t* it, const uint8_t** data, size_t* len);
 
 void lwcell_pbuf_set_ip(lwcell_pbuf_p pbuf, const lwcell_ip_t* ip, lwcell_port_t port);
 
+#if LWCELL_CFG_PBUF_POOL || __DOXYGEN__
+uint8_t lwcell_pbuf_pool_get_stats(size_t pool, lwcell_pbuf_pool_stats_t* stats);
+#endif /* LWCELL_CFG_PBUF_POOL || __DOXYGEN__ */
+
 /**
  * \}
  */
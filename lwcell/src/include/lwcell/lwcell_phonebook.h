@@ -63,6 +63,14 @@ lwcellr_t lwcell_pb_list(lwcell_mem_t mem, size_t start_index, lwcell_pb_entry_t
 lwcellr_t lwcell_pb_search(lwcell_mem_t mem, const char* search, lwcell_pb_entry_t* entries, size_t etr, size_t* er,
                          const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, const uint32_t blocking);
 
+#if LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__
+lwcellr_t lwcell_pb_mirror_load(lwcell_mem_t mem, const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg,
+                              const uint32_t blocking);
+uint8_t lwcell_pb_mirror_is_loaded(void);
+lwcellr_t lwcell_pb_mirror_find_number(const char* num, lwcell_pb_entry_t* entry);
+lwcellr_t lwcell_pb_mirror_find_name(const char* prefix, lwcell_pb_entry_t* entries, size_t etr, size_t* er);
+#endif /* LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__ */
+
 /**
  * \}
  */
@@ -206,6 +206,7 @@ typedef enum {
     LWCELL_CMD_CIPMUX,     /*!< Start Up Multi-IP Connection */
     LWCELL_CMD_CIPSTART,   /*!< Start Up TCP or UDP Connection */
     LWCELL_CMD_CIPSEND,    /*!< Send Data Through TCP or UDP Connection */
+    LWCELL_CMD_CIPSEND_GET, /*!< Query Maximum Data Length of TCP or UDP Connection */
     LWCELL_CMD_CIPQSEND,   /*!< Select Data Transmitting Mode */
     LWCELL_CMD_CIPACK,     /*!< Query Previous Connection Data Transmitting State */
     LWCELL_CMD_CIPCLOSE,   /*!< Close TCP or UDP Connection */
@@ -245,6 +246,7 @@ typedef enum {
     LWCELL_CMD_CMSS,         /*!< Send SMS Message from Storage */
     LWCELL_CMD_CMGDA,        /*!< MASS SMS delete */
     LWCELL_CMD_CNMI,         /*!< New SMS Message Indications */
+    LWCELL_CMD_CNMA,         /*!< New Message Acknowledgement to ME/TA */
     LWCELL_CMD_CPMS_SET,     /*!< Set preferred SMS Message Storage */
     LWCELL_CMD_CPMS_GET,     /*!< Get preferred SMS Message Storage */
     LWCELL_CMD_CPMS_GET_OPT, /*!< Get optional SMS message storages */
@@ -278,6 +280,25 @@ typedef struct lwcell_conn {
     lwcell_linbuff_t buff; /*!< Linear buffer structure */
 
     size_t total_recved; /*!< Total number of bytes received */
+#if LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__
+    size_t rx_unacked; /*!< Number of bytes sent to application and not yet confirmed with \ref lwcell_conn_recved */
+#endif                 /* LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_TX_COALESCE || __DOXYGEN__
+    struct lwcell_msg* tx_leader; /*!< Last queued send message, new small sends may be merged to */
+#endif                            /* LWCELL_CFG_CONN_TX_COALESCE || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__
+    uint32_t write_flush_time;  /*!< Delay in milliseconds after first byte in write buffer before it is sent */
+    size_t write_flush_size;    /*!< Number of bytes in write buffer to send it immediately */
+    uint32_t write_flush_start; /*!< Time when first byte was written to current write buffer */
+#endif                          /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND || __DOXYGEN__
+    size_t send_max;   /*!< Maximal data length per send command, reported by device */
+    size_t send_chunk; /*!< Current data length per send command */
+#endif                 /* LWCELL_CFG_CONN_ADAPTIVE_SEND || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_STATS || __DOXYGEN__
+    lwcell_conn_stats_t stats; /*!< Transport statistics */
+    uint32_t stats_evt_time;   /*!< Time since last statistics event in units of milliseconds */
+#endif                         /* LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
 
     union {
         struct {
@@ -287,10 +308,64 @@ typedef struct lwcell_conn {
             uint8_t in_closing    : 1; /*!< Status if connection is in closing mode.
                                                     When in closing mode, ignore any possible received data from function */
             uint8_t bearer        : 1; /*!< Bearer used. Can be `1` or `0` */
+#if LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__
+            uint8_t rx_avail       : 1; /*!< Status whether device has received data in its buffer */
+            uint8_t rx_read_queued : 1; /*!< Status whether read command is in producer queue or in progress */
+            uint8_t rx_manual_ack  : 1; /*!< Status whether application confirms received data with \ref lwcell_conn_recved */
+#endif                                  /* LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__
+            uint8_t write_flush_armed : 1; /*!< Status whether write buffer flush timeout is scheduled */
+            uint8_t write_blocked     : 1; /*!< Status whether write failed due to memory and application waits for writable event */
+#endif                                     /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__ */
         } f;                           /*!< Connection flags */
     } status;                          /*!< Connection status union with flag bits */
 } lwcell_conn_t;
 
+#if LWCELL_CFG_NETCONN || __DOXYGEN__
+
+/**
+ * \ingroup         LWCELL_NETCONN
+ * \brief           Sequential API structure
+ */
+typedef struct lwcell_netconn {
+    struct lwcell_netconn* next;    /*!< Linked list entry */
+
+    lwcell_netconn_type_t type;     /*!< Netconn type */
+
+    size_t rcv_packets;            /*!< Number of received packets so far on this connection */
+    lwcell_conn_p conn;             /*!< Pointer to actual connection */
+#if LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__
+    uint8_t conn_val_id;           /*!< Connection validation ID when data were written to receive mbox */
+#endif                             /* LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__ */
+
+    lwcell_sys_mbox_t mbox_receive; /*!< Message queue for receive mbox */
+
+    lwcell_linbuff_t buff;          /*!< Linear buffer structure */
+
+    uint16_t conn_timeout;         /*!< Connection timeout in units of seconds when
+                                                    netconn is in server (listen) mode.
+                                                    Connection will be automatically closed if there is no
+                                                    data exchange in time. Set to `0` when timeout feature is disabled. */
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+    uint32_t conn_idle;            /*!< Time in units of milliseconds since last data exchange */
+    lwcell_port_t listen_port;      /*!< Port used for listening in server mode */
+    lwcell_sys_mbox_t mbox_accept;  /*!< Message queue for accepting new connections */
+#endif                             /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
+
+#if LWCELL_CFG_NETCONN_RECEIVE_TIMEOUT || __DOXYGEN__
+    uint32_t rcv_timeout; /*!< Receive timeout in unit of milliseconds */
+#endif
+#if LWCELL_CFG_NETCONN_POLL || __DOXYGEN__
+    lwcell_sys_sem_t* poll_sem; /*!< Semaphore of thread waiting in poll, `NULL` when not polled */
+    size_t rcv_pending;         /*!< Number of entries in receive queue */
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+    size_t accept_pending;      /*!< Number of entries in accept queue */
+#endif                          /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
+#endif                          /* LWCELL_CFG_NETCONN_POLL || __DOXYGEN__ */
+} lwcell_netconn_t;
+
+#endif /* LWCELL_CFG_NETCONN || __DOXYGEN__ */
+
 /**
  * \ingroup         LWCELL_PBUF
  * \brief           Packet buffer structure
@@ -303,8 +378,25 @@ typedef struct lwcell_pbuf {
     uint8_t* payload;        /*!< Pointer to payload memory */
     lwcell_ip_t ip;           /*!< Remote address for received IPD data */
     lwcell_port_t port;       /*!< Remote port for received IPD data */
+#if LWCELL_CFG_PBUF_POOL || __DOXYGEN__
+    uint8_t pool; /*!< Pool number packet buffer belongs to, starting with `1`. Set to `0` when allocated dynamically */
+#endif            /* LWCELL_CFG_PBUF_POOL || __DOXYGEN__ */
 } lwcell_pbuf_t;
 
+/* Set size of pbuf structure */
+#define SIZEOF_PBUF_STRUCT LWCELL_MEM_ALIGN(sizeof(lwcell_pbuf_t))
+
+#if LWCELL_CFG_PBUF_POOL || __DOXYGEN__
+
+/* Size of single pool entry, packet buffer structure followed by payload */
+#define PBUF_POOL_ENTRY_SIZE(size) (SIZEOF_PBUF_STRUCT + LWCELL_MEM_ALIGN((size_t)(size)))
+#define PBUF_POOL_MEM_SIZE                                                                                             \
+    (PBUF_POOL_ENTRY_SIZE(LWCELL_CFG_PBUF_POOL_1_SIZE) * (LWCELL_CFG_PBUF_POOL_1_CNT)                                  \
+     + PBUF_POOL_ENTRY_SIZE(LWCELL_CFG_PBUF_POOL_2_SIZE) * (LWCELL_CFG_PBUF_POOL_2_CNT)                                \
+     + PBUF_POOL_ENTRY_SIZE(LWCELL_CFG_PBUF_POOL_3_SIZE) * (LWCELL_CFG_PBUF_POOL_3_CNT))
+
+#endif /* LWCELL_CFG_PBUF_POOL || __DOXYGEN__ */
+
 /**
  * \brief           Incoming network data read structure
  */
@@ -338,7 +430,22 @@ typedef struct lwcell_msg {
     uint8_t i;           /*!< Variable to indicate order number of subcommands */
     lwcell_sys_sem_t sem; /*!< Semaphore for the message */
     uint8_t is_blocking; /*!< Status if command is blocking */
+    uint8_t low_prio;    /*!< Set to `1` to let commands queued before start of execution go first */
+    uint8_t urgent;      /*!< Set to `1` to execute before commands waiting in queue. Non-blocking only */
+#if LWCELL_CFG_CMD_LATENCY || __DOXYGEN__
+    uint8_t lat_skip; /*!< Set to `1` when duration depends on amount of work, latency is not learned nor adapted */
+#endif                /* LWCELL_CFG_CMD_LATENCY || __DOXYGEN__ */
     uint32_t block_time; /*!< Maximal blocking time in units of milliseconds. Use 0 to for non-blocking call */
+#if LWCELL_CFG_CMD_HANDLE || LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+    uint32_t queue_time; /*!< Time when command was queued, used with deadline and pipeline statistics */
+#endif                   /* LWCELL_CFG_CMD_HANDLE || LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
+#if LWCELL_CFG_CMD_HANDLE || __DOXYGEN__
+    lwcell_cmd_handle_t* handle; /*!< Handle linked with command, `NULL` if not used */
+    uint8_t deadline;            /*!< Set to `1` when \ref block_time counts from \ref queue_time */
+    uint8_t cancel;              /*!< Set to `1` when command has been cancelled */
+    uint8_t released;            /*!< Set to `1` when blocking caller semaphore was released by producer */
+    uint8_t detached;            /*!< Set to `1` when blocking caller stopped waiting, producer frees message */
+#endif                           /* LWCELL_CFG_CMD_HANDLE || __DOXYGEN__ */
     lwcellr_t res;        /*!< Result of message operation */
     lwcellr_t (*fn)(struct lwcell_msg*); /*!< Processing callback function to process packet */
 
@@ -401,6 +508,7 @@ typedef struct lwcell_msg {
             size_t opsl;           /*!< Length of operators array */
             size_t opsi;           /*!< Current operator index array */
             size_t* opf;           /*!< Pointer to number of operators found */
+            uint8_t cancel;        /*!< Set to `1` when scan has been cancelled by user */
         } cops_scan;               /*!< Scan operators */
 
         struct {
@@ -427,10 +535,30 @@ typedef struct lwcell_msg {
             lwcell_conn_connect_res_t conn_res; /*!< Connection result status */
         } conn_start;                          /*!< Structure for starting new connection */
 
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND || __DOXYGEN__
+        struct {
+            uint8_t num; /*!< Connection number to query maximal data length for */
+        } conn_send_max; /*!< Query maximal data length of accepted connection */
+#endif                   /* LWCELL_CFG_CONN_ADAPTIVE_SEND || __DOXYGEN__ */
+
         struct {
             lwcell_conn_t* conn; /*!< Pointer to connection to close */
             uint8_t val_id;     /*!< Connection current validation ID when command was sent to queue */
         } conn_close;           /*!< Close connection */
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+        struct {
+            uint8_t en;              /*!< Set to `1` to enable server, `0` to disable it */
+            lwcell_port_t port;       /*!< Server port number */
+            lwcell_evt_fn evt_func;   /*!< Callback function for accepted connections */
+        } tcpip_server;              /*!< Server configuration */
+#endif                               /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__
+        struct {
+            lwcell_conn_t* conn; /*!< Pointer to connection to read data for */
+            uint8_t val_id;     /*!< Connection current validation ID when command was sent to queue */
+            lwcell_pbuf_p buff;  /*!< Packet buffer prepared for next read */
+        } conn_recv;            /*!< Read received data from device in manual receive mode */
+#endif                          /* LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__ */
 
         struct {
             lwcell_conn_t* conn;          /*!< Pointer to connection to send data */
@@ -446,6 +574,20 @@ typedef struct lwcell_msg {
             uint8_t fau;                 /*!< Free after use flag to free memory after data are sent (or not) */
             size_t* bw;                  /*!< Number of bytes written so far */
             uint8_t val_id;              /*!< Connection current validation ID when command was sent to queue */
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND || LWCELL_CFG_CONN_STATS || __DOXYGEN__
+            uint32_t send_time; /*!< Time when last packet send command was started */
+#endif                          /* LWCELL_CFG_CONN_ADAPTIVE_SEND || LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_STATS || __DOXYGEN__
+            uint32_t data_time; /*!< Time when last packet data were written after prompt */
+#endif                          /* LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_TX_COALESCE || __DOXYGEN__
+            uint8_t* merge_buff;     /*!< Buffer with merged data, allocated when first request is merged */
+            size_t merge_len;        /*!< Number of bytes of merged requests */
+            size_t own_len;          /*!< Number of bytes of this request only, once merged */
+            size_t* own_bw;          /*!< Number of bytes written pointer of this request, once merged */
+            uint8_t merged;          /*!< Set to `1` when merged buffer replaced request data */
+            struct lwcell_msg* next; /*!< Next send request merged to this command */
+#endif                               /* LWCELL_CFG_CONN_TX_COALESCE || __DOXYGEN__ */
         } conn_send;                     /*!< Structure to send data on connection */
 #endif                                   /* LWCELL_CFG_CONN || __DOXYGEN__ */
 #if LWCELL_CFG_SMS || __DOXYGEN__
@@ -454,7 +596,24 @@ typedef struct lwcell_msg {
             const char* text; /*!< SMS content to send */
             uint8_t format;   /*!< SMS format, `0 = PDU`, `1 = text` */
             size_t pos;       /*!< Set on +CMGS response if command is OK */
-        } sms_send;           /*!< Send SMS */
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+            const uint8_t* data;       /*!< Data to send in PDU mode */
+            size_t len;                /*!< Length of data to send in PDU mode */
+            lwcell_sms_coding_t coding; /*!< User data coding in PDU mode */
+            size_t off;                /*!< Offset of current part in data */
+            size_t part_len;           /*!< Number of data bytes encoded in current part */
+            uint8_t ref;               /*!< Concatenated message reference number */
+            uint8_t total;             /*!< Number of parts to send */
+            uint8_t seq;               /*!< Sequence number of current part, starting with `1` */
+#endif                                 /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
+#if LWCELL_CFG_SMS_BULK || __DOXYGEN__
+            lwcell_sms_bulk_t* bulk; /*!< Bulk SMS job, `NULL` for single message */
+            uint16_t cms_err;        /*!< Code of `+CMS ERROR` response */
+#endif                               /* LWCELL_CFG_SMS_BULK || __DOXYGEN__ */
+#if LWCELL_CFG_CMD_HANDLE || __DOXYGEN__
+            uint8_t prompt; /*!< Set to `1` once message has been sent after `> ` prompt */
+#endif                      /* LWCELL_CFG_CMD_HANDLE || __DOXYGEN__ */
+        } sms_send;         /*!< Send SMS */
 
         struct {
             lwcell_mem_t mem;          /*!< Memory to read from */
@@ -484,11 +643,21 @@ typedef struct lwcell_msg {
             uint8_t update;             /*!< Update SMS status after read operation */
             uint8_t format;             /*!< SMS format, `0 = PDU`, `1 = text` */
             uint8_t read;               /*!< Read the data flag */
+            lwcell_sms_list_fn fn;      /*!< Entry callback for streamed list, `entries` is single scratch entry */
+            void* fn_arg;               /*!< Custom argument for entry callback */
+            uint8_t stop;               /*!< Set to `1` when entry callback requested to stop */
         } sms_list;                     /*!< List SMS messages */
 
         struct {
             lwcell_mem_t mem[3]; /*!< Array of memories */
         } sms_memory;           /*!< Set preferred memories */
+#if LWCELL_CFG_SMS_DIRECT || __DOXYGEN__
+        struct {
+            uint8_t en;     /*!< Set to `1` to route new messages directly, `0` to store them */
+            uint8_t ack;    /*!< Set to `1` to acknowledge every directly routed message */
+            uint8_t format; /*!< SMS format for `+CMT` indications, `0 = PDU`, `1 = text` */
+        } sms_direct;       /*!< Set direct SMS delivery */
+#endif                      /* LWCELL_CFG_SMS_DIRECT || __DOXYGEN__ */
 #endif                          /* LWCELL_CFG_SMS || __DOXYGEN__ */
 #if LWCELL_CFG_CALL || __DOXYGEN__
         struct {
@@ -512,7 +681,10 @@ typedef struct lwcell_msg {
             size_t etr;                /*!< NUmber of entries to read */
             size_t ei;                 /*!< Current entry index */
             size_t* er;                /*!< Final entries read pointer for user */
-        } pb_list;                     /*!< List phonebook entries */
+#if LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__
+            uint8_t mirror; /*!< Mirror load state: `0` = regular list, `1` = set memory, `2` = get memory size */
+#endif                      /* LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__ */
+        } pb_list;          /*!< List phonebook entries */
 
         struct {
             lwcell_mem_t mem;           /*!< Memory to use */
@@ -531,6 +703,14 @@ typedef struct lwcell_msg {
             size_t resp_write_ptr; /*!< Write pointer for response */
             uint8_t quote_det;     /*!< Information if quote has been detected */
         } ussd;                    /*!< Execute USSD command */
+#if LWCELL_CFG_DNS || __DOXYGEN__
+        struct {
+            const char* host;                           /*!< Host name to resolve */
+            lwcell_ip_t* ip;                            /*!< Pointer to output IP address, `NULL` when only cache is updated */
+            char host_copy[LWCELL_CFG_DNS_HOST_MAX_LEN]; /*!< Host name copy for background refresh,
+                                                              cache entry may be reused while message is queued */
+        } dns;                                          /*!< Resolve host name */
+#endif                        /* LWCELL_CFG_DNS || __DOXYGEN__ */
 #if LWCELL_CFG_NETWORK || __DOXYGEN__
         struct {
             const char* apn;  /*!< APN address */
@@ -592,6 +772,20 @@ typedef struct {
     uint8_t enabled; /*!< Flag indicating feature enabled */
 
     lwcell_sms_mem_t mem[3]; /*!< 3 memory info for operation,receive,sent storage */
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+    uint8_t pdu[LWCELL_SMS_PDU_MAX_LEN];    /*!< PDU of message currently sent */
+    size_t pdu_len;                        /*!< Length of PDU in units of bytes */
+    uint8_t rx_pdu[LWCELL_SMS_PDU_MAX_LEN]; /*!< PDU of message currently received, kept apart from sent PDU
+                                                 as `+CMT` may arrive between `AT+CMGS` and its prompt */
+    size_t pdu_hex_cnt;                    /*!< Number of received hex characters of PDU */
+    uint8_t concat_ref;                 /*!< Reference number of last sent concatenated message */
+#endif                                  /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
+#if LWCELL_CFG_SMS_DIRECT || __DOXYGEN__
+    uint8_t direct;                     /*!< Set to `1` when new messages are routed with `+CMT` */
+    uint8_t direct_ack;                 /*!< Set to `1` when `+CMT` must be acknowledged with `AT+CNMA` */
+    uint8_t cmt_read;                   /*!< Body of `+CMT` is expected, `1` for text, `2` for PDU, `3` to skip */
+    lwcell_sms_entry_t cmt_entry;       /*!< Entry of message received with `+CMT` */
+#endif                                  /* LWCELL_CFG_SMS_DIRECT || __DOXYGEN__ */
 } lwcell_sms_t;
 
 /**
@@ -605,6 +799,26 @@ typedef struct {
     size_t used;            /*!< Number of used entries */
 } lwcell_pb_mem_t;
 
+#if LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__
+
+/**
+ * \ingroup         LWCELL_PB
+ * \brief           Local phonebook mirror
+ *
+ * Entries are kept unsorted, lookups go through index arrays sorted by number and by name
+ */
+typedef struct {
+    uint8_t valid;                                                  /*!< Set to `1` when mirror holds all entries of \ref mem */
+    lwcell_mem_t mem;                                               /*!< Mirrored memory */
+    size_t total;                                                   /*!< Size of mirrored memory in units of entries */
+    size_t cnt;                                                     /*!< Number of valid entries in \ref entries array */
+    lwcell_pb_entry_t entries[LWCELL_CFG_PHONEBOOK_MIRROR_SIZE];    /*!< Mirrored entries */
+    uint16_t idx_num[LWCELL_CFG_PHONEBOOK_MIRROR_SIZE];             /*!< Entry indexes sorted by trailing number digits */
+    uint16_t idx_name[LWCELL_CFG_PHONEBOOK_MIRROR_SIZE];            /*!< Entry indexes sorted by case-insensitive name */
+} lwcell_pb_mirror_t;
+
+#endif /* LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__ */
+
 /**
  * \ingroup         LWCELL_PB
  * \brief           Phonebook structure
@@ -614,6 +828,9 @@ typedef struct {
     uint8_t enabled; /*!< Flag indicating feature enabled */
 
     lwcell_pb_mem_t mem; /*!< Memory information */
+#if LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__
+    lwcell_pb_mirror_t mirror; /*!< Local phonebook mirror */
+#endif                         /* LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__ */
 } lwcell_pb_t;
 
 /**
@@ -634,6 +851,23 @@ typedef struct {
     lwcell_ip_t ip_addr;  /*!< Device IP address when network PDP context is enabled */
 } lwcell_network_t;
 
+#if LWCELL_CFG_MODEM_SHADOW || __DOXYGEN__
+
+/**
+ * \brief           Shadow of modem-side settings
+ *
+ * Each setting is valid only after successful set or get command.
+ * Current storages are kept in \ref lwcell_sms_t and \ref lwcell_pb_t structures
+ */
+typedef struct {
+    uint8_t sms_format_valid; /*!< Set to `1` when \ref sms_format holds format set on device */
+    uint8_t sms_format;       /*!< SMS message format set on device, `0` = PDU, `1` = text */
+    uint8_t sms_mem_valid;    /*!< Bit field of valid SMS memories, bit `x` corresponds to `sms.mem[x].current` */
+    uint8_t pb_mem_valid;     /*!< Set to `1` when `pb.mem.current` holds storage set on device */
+} lwcell_modem_shadow_t;
+
+#endif /* LWCELL_CFG_MODEM_SHADOW || __DOXYGEN__ */
+
 /**
  * \brief           GSM modules structure
  */
@@ -657,7 +891,16 @@ typedef struct {
     lwcell_conn_t conns[LWCELL_CFG_MAX_CONNS]; /*!< Array of all connection structures */
     lwcell_ipd_t ipd;                         /*!< Connection incoming data structure */
     uint8_t conn_val_id;                     /*!< Validation ID increased each time device connects to network */
-#endif                                       /* LWCELL_CFG_CONNS || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_TRANSPARENT || __DOXYGEN__
+    uint8_t data_mode;          /*!< Set to `1` when device is in transparent data mode and AT port carries raw data */
+    uint8_t data_mode_close_ptr; /*!< Number of matched characters of remote close sequence in data mode */
+#endif                          /* LWCELL_CFG_CONN_TRANSPARENT || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+    lwcell_evt_fn server_evt_func; /*!< Callback function for connections accepted by server */
+    lwcell_port_t server_port;     /*!< Port server is listening on */
+    uint8_t server_active;        /*!< Set to `1` when server is listening for connections */
+#endif                            /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
+#endif                          /* LWCELL_CFG_CONNS || __DOXYGEN__ */
 #if LWCELL_CFG_SMS || __DOXYGEN__
     lwcell_sms_t sms; /*!< SMS information */
 #endif               /* LWCELL_CFG_SMS || __DOXYGEN__ */
@@ -667,8 +910,24 @@ typedef struct {
 #if LWCELL_CFG_CALL || __DOXYGEN__
     lwcell_call_t call; /*!< Call information */
 #endif                 /* LWCELL_CFG_CALL || __DOXYGEN__ */
+#if LWCELL_CFG_MODEM_SHADOW || __DOXYGEN__
+    lwcell_modem_shadow_t shadow; /*!< Shadow of modem-side settings */
+#endif                            /* LWCELL_CFG_MODEM_SHADOW || __DOXYGEN__ */
 } lwcell_modules_t;
 
+#if LWCELL_CFG_CMD_LATENCY || __DOXYGEN__
+
+/**
+ * \brief           Command completion latency statistics
+ */
+typedef struct {
+    uint32_t est;    /*!< Latency percentile estimate in units of milliseconds */
+    uint32_t budget; /*!< Fixed timeout of commands samples were recorded with */
+    uint16_t cnt;    /*!< Number of recorded samples, saturated at maximum value */
+} lwcell_cmd_latency_t;
+
+#endif /* LWCELL_CFG_CMD_LATENCY || __DOXYGEN__ */
+
 /**
  * \brief           GSM global structure
  */
@@ -686,6 +945,19 @@ typedef struct {
     lwcell_ll_t ll;     /*!< Low level functions */
 
     lwcell_msg_t* msg; /*!< Pointer to current user message being executed */
+    lwcell_msg_t* msg_low_prio; /*!< Low priority message waiting for queued commands to finish first */
+    lwcell_msg_t* msg_urgent;   /*!< Urgent message executed before queued commands, single message at a time */
+    size_t msg_low_prio_skip;   /*!< Number of commands still allowed to go before \ref msg_low_prio */
+#if LWCELL_CFG_CMD_LATENCY || __DOXYGEN__
+    lwcell_cmd_latency_t cmd_latency[LWCELL_CMD_END]; /*!< Latency statistics per command type, kept over reset */
+#endif                                                /* LWCELL_CFG_CMD_LATENCY || __DOXYGEN__ */
+#if LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+    lwcell_pipe_stats_t pipe;                         /*!< Pipeline statistics */
+    lwcell_pipe_cmd_stats_t pipe_cmd[LWCELL_CMD_END]; /*!< Pipeline statistics per command type */
+    uint32_t pipe_lock_time;                          /*!< Time when core lock was taken */
+    uint32_t pipe_fn_time;                            /*!< Time when current command started execution */
+    uint8_t pipe_wait_byte;                           /*!< Set to `1` while first byte of current command is pending */
+#endif                                                /* LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
 
     lwcell_evt_t evt;            /*!< Callback processing structure */
     lwcell_evt_func_t* evt_func; /*!< Callback function linked list */
@@ -744,13 +1016,17 @@ extern const size_t lwcell_dev_model_map_size;
 #define CMD_GET_CUR()              ((lwcell_cmd_t)(((lwcell.msg != NULL) ? lwcell.msg->cmd : LWCELL_CMD_IDLE)))
 #define CMD_GET_DEF()              ((lwcell_cmd_t)(((lwcell.msg != NULL) ? lwcell.msg->cmd_def : LWCELL_CMD_IDLE)))
 
+/* Entry in use by SMS list, streamed list reuses single entry */
+#define LWCELL_SMS_LIST_ENTRY(m)                                                                                       \
+    (&(m)->msg.sms_list.entries[(m)->msg.sms_list.fn != NULL ? 0 : (m)->msg.sms_list.ei])
+
 #define CRLF                       "\r\n"
 #define CRLF_LEN                   2
 
 #define LWCELL_MSG_VAR_DEFINE(name) lwcell_msg_t* name
 #define LWCELL_MSG_VAR_ALLOC(name, blocking)                                                                            \
     do {                                                                                                               \
-        (name) = lwcell_mem_malloc(sizeof(*(name)));                                                                    \
+        (name) = LWCELL_MEM_MALLOC(sizeof(*(name)), LWCELL_MEM_TAG_MSG);                                                \
         LWCELL_DEBUGW(LWCELL_CFG_DBG_VAR | LWCELL_DBG_TYPE_TRACE, (name) != NULL,                                         \
                      "[MSG VAR] Allocated %d bytes at %p\r\n", (int)sizeof(*(name)), (void*)(name));                   \
         LWCELL_DEBUGW(LWCELL_CFG_DBG_VAR | LWCELL_DBG_TYPE_TRACE, (name) == NULL,                                         \
@@ -785,6 +1061,21 @@ extern const size_t lwcell_dev_model_map_size;
     } while (0)
 #endif /* !LWCELL_CFG_USE_API_FUNC_EVT */
 
+#if LWCELL_CFG_CMD_HANDLE
+#define LWCELL_MSG_VAR_SET_HANDLE(name, h)                                                                              \
+    do {                                                                                                               \
+        if ((h) != NULL) {                                                                                             \
+            (h)->msg = NULL;                                                                                           \
+        }                                                                                                              \
+        (name)->handle = (h);                                                                                          \
+    } while (0)
+#else /* LWCELL_CFG_CMD_HANDLE */
+#define LWCELL_MSG_VAR_SET_HANDLE(name, h)                                                                              \
+    do {                                                                                                               \
+        LWCELL_UNUSED(h);                                                                                               \
+    } while (0)
+#endif /* !LWCELL_CFG_CMD_HANDLE */
+
 #define LWCELL_CHARISNUM(x)    ((x) >= '0' && (x) <= '9')
 #define LWCELL_CHARTONUM(x)    ((x) - '0')
 #define LWCELL_CHARISHEXNUM(x) (((x) >= '0' && (x) <= '9') || ((x) >= 'a' && (x) <= 'f') || ((x) >= 'A' && (x) <= 'F'))
@@ -809,9 +1100,48 @@ lwcellr_t lwcelli_send_msg_to_producer_mbox(lwcell_msg_t* msg, lwcellr_t (*proce
 uint32_t lwcelli_get_from_mbox_with_timeout_checks(lwcell_sys_mbox_t* b, void** m, uint32_t timeout);
 uint8_t lwcelli_conn_closed_process(uint8_t conn_num, uint8_t forced);
 void lwcelli_conn_start_timeout(lwcell_conn_p conn);
+#if LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__
+void lwcelli_conn_manual_rx_start(lwcell_conn_p conn);
+void lwcelli_conn_manual_rx_retry(lwcell_conn_p conn);
+#endif /* LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_TX_COALESCE || __DOXYGEN__
+void lwcelli_conn_send_coalesce_finish(lwcell_msg_t* msg);
+#endif /* LWCELL_CFG_CONN_TX_COALESCE || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__
+void lwcelli_conn_writable_check(void);
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__ */
+#if LWCELL_CFG_DNS || __DOXYGEN__
+uint8_t lwcelli_dns_cache_lookup(const char* host, lwcell_ip_t* ip);
+uint8_t lwcelli_dns_cache_need_resolve(const char* host);
+void lwcelli_dns_cache_update(const char* host, const lwcell_ip_t* ip);
+#endif /* LWCELL_CFG_DNS || __DOXYGEN__ */
 
 lwcellr_t lwcelli_get_sim_info(const uint32_t blocking);
 
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+size_t lwcelli_sms_pdu_segment(const void* data, size_t len, lwcell_sms_coding_t coding, uint8_t concat,
+                               size_t* units);
+size_t lwcelli_sms_pdu_encode(uint8_t* pdu, const char* num, const void* data, size_t len, lwcell_sms_coding_t coding,
+                              uint8_t ref, uint8_t total, uint8_t seq, size_t* used);
+#endif /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
+#if LWCELL_CFG_SMS_DIRECT || __DOXYGEN__
+void lwcelli_sms_direct_done(void);
+#endif /* LWCELL_CFG_SMS_DIRECT || __DOXYGEN__ */
+#if LWCELL_CFG_SMS_BULK || __DOXYGEN__
+uint8_t lwcelli_sms_bulk_process(lwcell_msg_t* msg, lwcellr_t res);
+#endif /* LWCELL_CFG_SMS_BULK || __DOXYGEN__ */
+#if LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__
+uint8_t lwcelli_pb_mirror_loaded(lwcell_msg_t* msg, uint8_t is_ok);
+size_t lwcelli_pb_mirror_free_pos(void);
+void lwcelli_pb_mirror_write(lwcell_msg_t* msg);
+#endif /* LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__ */
+
+uint8_t lwcelli_cmd_abort(lwcell_msg_t* msg);
+#if LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+void lwcelli_pipe_hist_add(lwcell_pipe_hist_t* h, uint32_t ms);
+void lwcelli_input_get_stats(uint32_t* len, uint32_t* calls);
+#endif /* LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
+
 void lwcelli_reset_everything(uint8_t forced);
 void lwcelli_process_events_for_timeout_or_error(lwcell_msg_t* msg, lwcellr_t err);
 
@@ -52,6 +52,10 @@ lwcellr_t lwcell_sms_disable(const lwcell_api_cmd_evt_fn evt_fn, void* const evt
 
 lwcellr_t lwcell_sms_send(const char* num, const char* text, const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg,
                           const uint32_t blocking);
+#if LWCELL_CFG_CMD_HANDLE || __DOXYGEN__
+lwcellr_t lwcell_sms_send_with_handle(const char* num, const char* text, lwcell_cmd_handle_t* h,
+                                      const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, const uint32_t blocking);
+#endif /* LWCELL_CFG_CMD_HANDLE || __DOXYGEN__ */
 lwcellr_t lwcell_sms_read(lwcell_mem_t mem, size_t pos, lwcell_sms_entry_t* entry, uint8_t update,
                           const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, const uint32_t blocking);
 lwcellr_t lwcell_sms_delete(lwcell_mem_t mem, size_t pos, const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg,
@@ -61,10 +65,32 @@ lwcellr_t lwcell_sms_delete_all(lwcell_sms_status_t status, const lwcell_api_cmd
 lwcellr_t lwcell_sms_list(lwcell_mem_t mem, lwcell_sms_status_t stat, lwcell_sms_entry_t* entries, size_t etr,
                           size_t* er, uint8_t update, const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg,
                           const uint32_t blocking);
+lwcellr_t lwcell_sms_list_stream(lwcell_mem_t mem, lwcell_sms_status_t stat, lwcell_sms_entry_t* entry,
+                                 lwcell_sms_list_fn fn, void* fn_arg, size_t* er, uint8_t update,
+                                 const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, const uint32_t blocking);
 lwcellr_t lwcell_sms_set_preferred_storage(lwcell_mem_t mem1, lwcell_mem_t mem2, lwcell_mem_t mem3,
                                            const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg,
                                            const uint32_t blocking);
 
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+lwcellr_t lwcell_sms_send_ex(const char* num, const void* data, size_t len, lwcell_sms_coding_t coding,
+                             const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, const uint32_t blocking);
+lwcellr_t lwcell_sms_pdu_decode(const void* pdu, size_t len, uint8_t has_smsc, lwcell_sms_pdu_t* info, void* data,
+                                size_t data_size, size_t* data_len);
+void lwcell_sms_concat_init(lwcell_sms_concat_t* c, void* buff, size_t part_size);
+lwcellr_t lwcell_sms_concat_add(lwcell_sms_concat_t* c, const lwcell_sms_pdu_t* info, const void* data, size_t len);
+#endif /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
+
+#if LWCELL_CFG_SMS_DIRECT || __DOXYGEN__
+lwcellr_t lwcell_sms_set_direct_delivery(uint8_t en, uint8_t ack, const lwcell_api_cmd_evt_fn evt_fn,
+                                         void* const evt_arg, const uint32_t blocking);
+#endif /* LWCELL_CFG_SMS_DIRECT || __DOXYGEN__ */
+
+#if LWCELL_CFG_SMS_BULK || __DOXYGEN__
+lwcellr_t lwcell_sms_bulk_start(lwcell_sms_bulk_t* job, const char* const* nums, lwcell_sms_bulk_result_t* results,
+                                size_t count, const char* text, uint32_t rate);
+#endif /* LWCELL_CFG_SMS_BULK || __DOXYGEN__ */
+
 /**
  * \}
  */
@@ -144,6 +144,41 @@ typedef enum {
     LWCELL_CONN_TYPE_SSL, /*!< Connection type is TCP over SSL */
 } lwcell_conn_type_t;
 
+#if LWCELL_CFG_CONN_STATS || __DOXYGEN__
+
+/**
+ * \ingroup         LWCELL_CONN
+ * \brief           Number of bins in `SEND OK` latency histogram
+ *
+ * Bin `i` counts responses received in less than `50 * 2^i` milliseconds,
+ * last bin counts all slower responses
+ */
+#define LWCELL_CONN_STATS_LATENCY_BINS 8
+
+/**
+ * \ingroup         LWCELL_CONN
+ * \brief           Connection transport statistics
+ */
+typedef struct {
+    uint32_t tx_bytes;               /*!< Number of bytes confirmed with `SEND OK` */
+    uint32_t tx_chunks;              /*!< Number of send commands confirmed with `SEND OK` */
+    uint32_t tx_fails;               /*!< Number of `SEND FAIL` responses */
+    uint32_t tx_retries;             /*!< Number of send commands repeated after `SEND FAIL` */
+    uint32_t tx_prompts;             /*!< Number of `>` prompts received after `AT+CIPSEND` */
+    uint32_t prompt_latency_sum;     /*!< Sum of times in milliseconds between `AT+CIPSEND` and `>` prompt */
+    uint32_t prompt_latency_max;     /*!< Maximal time in milliseconds between `AT+CIPSEND` and `>` prompt */
+    uint32_t send_ok_latency_sum;    /*!< Sum of times in milliseconds between data sent and `SEND OK` */
+    uint32_t send_ok_latency_max;    /*!< Maximal time in milliseconds between data sent and `SEND OK` */
+    uint32_t send_ok_latency_hist[LWCELL_CONN_STATS_LATENCY_BINS]; /*!< Histogram of `SEND OK` latencies */
+    uint32_t rx_bytes;               /*!< Number of received bytes sent to application */
+    uint32_t rx_chunks;              /*!< Number of packet buffers sent to application */
+    uint32_t rx_chunk_min;           /*!< Smallest received packet buffer length */
+    uint32_t rx_chunk_max;           /*!< Largest received packet buffer length */
+    uint32_t rx_alloc_fails;         /*!< Number of failed packet buffer allocations for received data */
+} lwcell_conn_stats_t;
+
+#endif /* LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
+
 /**
  * \ingroup         LWCELL_TYPES
  * \brief           Available device memories
@@ -181,6 +216,29 @@ typedef enum {
     LWCELL_SMS_STATUS_INBOX,  /*!< SMS status, used only for mass delete operation */
 } lwcell_sms_status_t;
 
+/**
+ * \ingroup         LWCELL_SMS
+ * \brief           SMS user data coding
+ */
+typedef enum {
+    LWCELL_SMS_CODING_GSM7, /*!< GSM 7-bit default alphabet. Text is exchanged with application in UTF-8 format */
+    LWCELL_SMS_CODING_8BIT, /*!< 8-bit binary data */
+    LWCELL_SMS_CODING_UCS2, /*!< UCS2 alphabet. Text is exchanged with application in UTF-8 format */
+} lwcell_sms_coding_t;
+
+/**
+ * \ingroup         LWCELL_SMS
+ * \brief           Maximal length of SMS text in entry structure, excluding `NULL` termination
+ *
+ * In PDU mode, text is decoded to UTF-8 format. Single-part message holds up to `160` GSM 7-bit
+ * characters, each taking up to `2` bytes in UTF-8 format, or up to `70` UCS2 characters, each taking up to `3` bytes
+ */
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+#define LWCELL_SMS_DATA_MAX_LEN 320
+#else /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
+#define LWCELL_SMS_DATA_MAX_LEN 160
+#endif /* !(LWCELL_CFG_SMS_PDU || __DOXYGEN__) */
+
 /**
  * \ingroup         LWCELL_SMS
  * \brief           SMS entry structure
@@ -192,10 +250,100 @@ typedef struct {
     lwcell_sms_status_t status; /*!< Message status */
     char number[26];           /*!< Phone number */
     char name[20];             /*!< Name in phonebook if exists */
-    char data[161];            /*!< Data memory */
+    char data[LWCELL_SMS_DATA_MAX_LEN + 1]; /*!< Data memory */
     size_t length;             /*!< Length of SMS data */
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+    lwcell_sms_coding_t coding; /*!< User data coding */
+    uint16_t concat_ref;       /*!< Concatenated message reference number */
+    uint8_t concat_total;      /*!< Number of parts of concatenated message, `0` if message is not concatenated */
+    uint8_t concat_seq;        /*!< Sequence number of this part, starting with `1` */
+#endif                         /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
 } lwcell_sms_entry_t;
 
+/**
+ * \ingroup         LWCELL_SMS
+ * \brief           Callback function for streamed SMS list
+ * \param[in]       entry: Parsed SMS entry, valid only during callback execution
+ * \param[in]       arg: Custom user argument
+ * \return          `1` to continue listing, `0` to stop and ignore remaining entries
+ */
+typedef uint8_t (*lwcell_sms_list_fn)(const lwcell_sms_entry_t* entry, void* arg);
+
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+
+/**
+ * \ingroup         LWCELL_SMS
+ * \brief           Maximal length of SMS PDU in units of bytes, including service center address
+ */
+#define LWCELL_SMS_PDU_MAX_LEN 176
+
+/**
+ * \ingroup         LWCELL_SMS
+ * \brief           Decoded SMS PDU information
+ */
+typedef struct {
+    uint8_t is_submit;         /*!< Set to `1` for `SMS-SUBMIT` (outgoing) message, `0` for `SMS-DELIVER` */
+    char number[26];           /*!< Originating address for `SMS-DELIVER`, destination address for `SMS-SUBMIT` */
+    struct tm dt;              /*!< Service center time stamp, valid for `SMS-DELIVER` only */
+    lwcell_sms_coding_t coding; /*!< User data coding */
+    uint16_t concat_ref;       /*!< Concatenated message reference number */
+    uint8_t concat_total;      /*!< Number of parts of concatenated message, `0` if message is not concatenated */
+    uint8_t concat_seq;        /*!< Sequence number of this part, starting with `1` */
+} lwcell_sms_pdu_t;
+
+/**
+ * \ingroup         LWCELL_SMS
+ * \brief           Concatenated message reassembly structure
+ *
+ * Parts are written to fixed slots of application buffer, in any order they are received.
+ * Data are moved to contiguous memory once all parts are received.
+ */
+typedef struct {
+    uint8_t* buff;                                    /*!< Application buffer for all parts */
+    size_t part_size;                                 /*!< Size of one part slot in buffer */
+    char number[26];                                  /*!< Sender of message in progress */
+    uint16_t ref;                                     /*!< Reference of message in progress */
+    uint8_t total;                                    /*!< Number of parts, `0` when no message in progress */
+    uint32_t received;                                /*!< Bit field of received parts */
+    size_t part_len[LWCELL_CFG_SMS_CONCAT_MAX_PARTS]; /*!< Length of each received part */
+    size_t len;                                       /*!< Length of reassembled message */
+} lwcell_sms_concat_t;
+
+#endif /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
+
+#if LWCELL_CFG_SMS_BULK || __DOXYGEN__
+
+/**
+ * \ingroup         LWCELL_SMS
+ * \brief           Result of single recipient of bulk SMS job
+ */
+typedef struct {
+    lwcellr_t res;    /*!< Send result, \ref lwcellINPROG until recipient is processed */
+    size_t pos;       /*!< Message reference reported by `+CMGS` on success */
+    uint16_t cms_err; /*!< Last `+CMS ERROR` code, `0` if none received */
+    uint8_t tries;    /*!< Number of send attempts */
+} lwcell_sms_bulk_result_t;
+
+/**
+ * \ingroup         LWCELL_SMS
+ * \brief           Bulk SMS job
+ *
+ * Job memory is owned by application and must stay valid until job completes,
+ * reported by \ref LWCELL_EVT_SMS_BULK event with done flag set.
+ */
+typedef struct {
+    const char* const* nums;          /*!< Array of recipient numbers */
+    lwcell_sms_bulk_result_t* results; /*!< Array of results, one for each recipient */
+    size_t count;                     /*!< Number of recipients */
+    const char* text;                 /*!< Text to send, maximal `160` characters */
+    uint32_t rate;                    /*!< Maximal number of messages per minute, `0` for no limit */
+    size_t idx;                       /*!< Index of recipient in progress */
+    uint32_t next_time;               /*!< Earliest time for next send attempt */
+    uint8_t active;                   /*!< Set to `1` while job is in progress */
+} lwcell_sms_bulk_t;
+
+#endif /* LWCELL_CFG_SMS_BULK || __DOXYGEN__ */
+
 /**
  * \ingroup         LWCELL_PB
  * \brief           Phonebook entry structure
@@ -350,6 +498,117 @@ typedef struct lwcell_conn* lwcell_conn_p;
  */
 typedef struct lwcell_pbuf* lwcell_pbuf_p;
 
+/**
+ * \ingroup         LWCELL_PBUF
+ * \brief           Packet buffer pool statistics
+ */
+typedef struct {
+    size_t size;      /*!< Payload size of single pool entry in units of bytes */
+    size_t cnt;       /*!< Total number of entries in pool */
+    size_t used;      /*!< Number of entries currently in use */
+    size_t used_max;  /*!< Maximal number of entries in use at the same time (high watermark) */
+    size_t exhausted; /*!< Number of allocations that did not find free entry in this pool */
+} lwcell_pbuf_pool_stats_t;
+
+/**
+ * \ingroup         LWCELL_MEM
+ * \brief           Memory allocation tags, identifying subsystem that owns allocated memory
+ * \sa              LWCELL_MEM_MALLOC, LWCELL_MEM_CALLOC
+ */
+typedef enum {
+    LWCELL_MEM_TAG_OTHER = 0x00, /*!< Untagged allocations, \ref lwcell_mem_malloc and other plain functions */
+    LWCELL_MEM_TAG_PBUF,         /*!< Packet buffers */
+    LWCELL_MEM_TAG_MSG,          /*!< Messages queued to producer thread */
+    LWCELL_MEM_TAG_CONN_BUFF,    /*!< Connection and netconn write buffers */
+    LWCELL_MEM_TAG_TIMEOUT,      /*!< Timeout entries */
+    LWCELL_MEM_TAG_NETCONN,      /*!< Netconn objects */
+    LWCELL_MEM_TAG_MQTT,         /*!< MQTT client objects and buffers */
+    LWCELL_MEM_TAG_END,          /*!< Last element, used as number of tags */
+} lwcell_mem_tag_t;
+
+#if LWCELL_CFG_MEM_STATS || __DOXYGEN__
+
+/**
+ * \ingroup         LWCELL_MEM
+ * \brief           Memory statistics for single allocation tag
+ * \note            Bytes include allocator block metadata
+ */
+typedef struct {
+    size_t cur_bytes;   /*!< Number of bytes currently allocated */
+    size_t peak_bytes;  /*!< Maximal number of bytes allocated at the same time (high watermark) */
+    uint32_t alloc_cnt; /*!< Number of successful allocations */
+    uint32_t fail_cnt;  /*!< Number of failed allocations */
+} lwcell_mem_tag_stats_t;
+
+/**
+ * \ingroup         LWCELL_MEM
+ * \brief           Memory statistics
+ */
+typedef struct {
+    lwcell_mem_tag_stats_t tags[LWCELL_MEM_TAG_END]; /*!< Statistics per allocation tag, indexed by \ref lwcell_mem_tag_t */
+    size_t used_bytes;         /*!< Number of bytes currently allocated by all tags */
+    size_t peak_used_bytes;    /*!< Maximal number of bytes allocated by all tags at the same time */
+    size_t available_bytes;    /*!< Number of free bytes in all regions */
+    size_t largest_free_block; /*!< Size of largest memory block that can currently be allocated */
+} lwcell_mem_stats_t;
+
+#endif /* LWCELL_CFG_MEM_STATS || __DOXYGEN__ */
+
+#if LWCELL_CFG_MEM_STATIC || __DOXYGEN__
+
+/**
+ * \ingroup         LWCELL_MEM
+ * \brief           Static memory footprint of static allocation mode, calculated at compile time
+ * \sa              lwcell_mem_static_footprint
+ */
+typedef struct {
+    size_t entry_size[LWCELL_MEM_TAG_END]; /*!< Entry size of pool per allocation tag, indexed by \ref lwcell_mem_tag_t */
+    size_t entry_cnt[LWCELL_MEM_TAG_END];  /*!< Number of entries of pool per allocation tag */
+    size_t pools_bytes;                    /*!< Memory for all allocation tag pools */
+    size_t pbuf_pools_bytes;               /*!< Memory for packet buffer pools, see \ref LWCELL_CFG_PBUF_POOL */
+    size_t total_bytes;                    /*!< Total static memory used for allocations */
+} lwcell_mem_static_footprint_t;
+
+#endif /* LWCELL_CFG_MEM_STATIC || __DOXYGEN__ */
+
+#if LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+
+/**
+ * \ingroup         LWCELL_TYPES
+ * \brief           Time histogram of pipeline statistics
+ * \sa              LWCELL_CFG_PIPE_STATS_BUCKETS
+ */
+typedef struct {
+    uint16_t bucket[LWCELL_CFG_PIPE_STATS_BUCKETS]; /*!< Number of samples per bucket, saturated at maximum value */
+    uint32_t max;                                   /*!< Longest recorded sample in units of milliseconds */
+} lwcell_pipe_hist_t;
+
+/**
+ * \ingroup         LWCELL_TYPES
+ * \brief           Pipeline statistics of single command type
+ */
+typedef struct {
+    lwcell_pipe_hist_t queue;      /*!< Time from command put to producer queue to start of its execution */
+    lwcell_pipe_hist_t first_byte; /*!< Time from start of execution to first byte received from device */
+    lwcell_pipe_hist_t done;       /*!< Time from start of execution to completion or timeout */
+} lwcell_pipe_cmd_stats_t;
+
+/**
+ * \ingroup         LWCELL_TYPES
+ * \brief           Pipeline statistics
+ */
+typedef struct {
+    lwcell_pipe_hist_t lock;   /*!< Core lock hold time */
+    size_t queue_depth;        /*!< Number of commands currently waiting for execution */
+    size_t queue_depth_max;    /*!< Maximal number of commands waiting for execution at the same time */
+    size_t buff_max;           /*!< Maximal input buffer fill level. Always `0` with \ref LWCELL_CFG_INPUT_USE_PROCESS */
+    uint32_t recv_len;         /*!< Total number of bytes received from device */
+    uint32_t recv_calls;       /*!< Total number of input function calls */
+    uint32_t since;            /*!< System time of last statistics reset in units of milliseconds */
+} lwcell_pipe_stats_t;
+
+#endif /* LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
+
 /**
  * \ingroup         LWCELL_EVT
  * \brief           Event function prototype
@@ -377,12 +636,17 @@ typedef enum lwcell_cb_type_t {
 
     LWCELL_EVT_KEEP_ALIVE,               /*!< Generic keep-alive event type, used as periodic timeout.
                                                     Optionally enabled with \ref LWCELL_CFG_KEEP_ALIVE */
+#if LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+    LWCELL_EVT_PIPE_STATS,               /*!< Periodic pipeline statistics event.
+                                                    Enabled with \ref LWCELL_CFG_PIPE_STATS_EVT_INTERVAL */
+#endif                                   /* LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
 
     LWCELL_EVT_SIGNAL_STRENGTH,          /*!< Signal strength event */
 
     LWCELL_EVT_SIM_STATE_CHANGED,        /*!< SIM card state changed */
 
     LWCELL_EVT_OPERATOR_SCAN,            /*!< Operator scan finished event */
+    LWCELL_EVT_OPERATOR_SCAN_ENTRY,      /*!< Operator scan entry parsed, scan still in progress */
 
     LWCELL_EVT_NETWORK_OPERATOR_CURRENT, /*!< Current operator event */
     LWCELL_EVT_NETWORK_REG_CHANGED,      /*!< Network registration changed.
@@ -399,6 +663,15 @@ typedef enum lwcell_cb_type_t {
     LWCELL_EVT_CONN_ERROR,  /*!< Client connection start was not successful */
     LWCELL_EVT_CONN_CLOSE,  /*!< Connection close event. Check status if successful */
     LWCELL_EVT_CONN_POLL,   /*!< Poll for connection if there are any changes */
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__
+    LWCELL_EVT_CONN_WRITABLE, /*!< Memory is available again for \ref lwcell_conn_write after previous failure */
+#endif                       /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+    LWCELL_EVT_SERVER, /*!< Server status changed, enabled or disabled */
+#endif                /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_STATS || __DOXYGEN__
+    LWCELL_EVT_CONN_STATS, /*!< Periodic connection statistics report */
+#endif                    /* LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
 #endif                     /* LWCELL_CFG_CONN || __DOXYGEN__ */
 
 #if LWCELL_CFG_SMS || __DOXYGEN__
@@ -409,6 +682,12 @@ typedef enum lwcell_cb_type_t {
     LWCELL_EVT_SMS_READ,        /*!< SMS read */
     LWCELL_EVT_SMS_DELETE,      /*!< SMS delete */
     LWCELL_EVT_SMS_LIST,        /*!< SMS list */
+#if LWCELL_CFG_SMS_DIRECT || __DOXYGEN__
+    LWCELL_EVT_SMS_DELIVER,     /*!< SMS received directly with `+CMT`, without storage */
+#endif                         /* LWCELL_CFG_SMS_DIRECT || __DOXYGEN__ */
+#if LWCELL_CFG_SMS_BULK || __DOXYGEN__
+    LWCELL_EVT_SMS_BULK,        /*!< Bulk SMS job recipient processed or job finished */
+#endif                         /* LWCELL_CFG_SMS_BULK || __DOXYGEN__ */
 #endif                         /* LWCELL_CFG_SMS || __DOXYGEN__ */
 #if LWCELL_CFG_CALL || __DOXYGEN__
     LWCELL_EVT_CALL_ENABLE,     /*!< Call enable event */
@@ -455,6 +734,17 @@ typedef struct lwcell_evt {
             lwcellr_t res;          /*!< Scan operation result */
         } operator_scan;           /*!< Operator scan event. Use with \ref LWCELL_EVT_OPERATOR_SCAN event */
 
+        struct {
+            const lwcell_operator_t* op; /*!< Parsed operator entry */
+            size_t idx;                  /*!< Entry index in user array */
+        } operator_scan_entry; /*!< Operator scan entry. Use with \ref LWCELL_EVT_OPERATOR_SCAN_ENTRY event */
+
+#if LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+        struct {
+            const lwcell_pipe_stats_t* stats; /*!< Pipeline statistics */
+        } pipe_stats; /*!< Pipeline statistics. Use with \ref LWCELL_EVT_PIPE_STATS event */
+#endif                /* LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
+
         struct {
             int16_t rssi; /*!< Strength in units of dBm */
         } rssi;           /*!< Signal strength event. Use with \ref LWCELL_EVT_SIGNAL_STRENGTH event */
@@ -489,6 +779,24 @@ typedef struct lwcell_evt {
         struct {
             lwcell_conn_p conn; /*!< Set connection pointer */
         } conn_poll; /*!< Polling active connection to check for timeouts. Use with \ref LWCELL_EVT_CONN_POLL event */
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__
+        struct {
+            lwcell_conn_p conn; /*!< Set connection pointer */
+        } conn_writable; /*!< Connection write buffer may be allocated again. Use with \ref LWCELL_EVT_CONN_WRITABLE event */
+#endif                   /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_STATS || __DOXYGEN__
+        struct {
+            lwcell_conn_p conn;                /*!< Set connection pointer */
+            const lwcell_conn_stats_t* stats;  /*!< Connection statistics */
+        } conn_stats; /*!< Periodic connection statistics. Use with \ref LWCELL_EVT_CONN_STATS event */
+#endif                /* LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+        struct {
+            lwcellr_t res;      /*!< Server command result */
+            uint8_t en;        /*!< Set to `1` if server is enabled, `0` otherwise */
+            lwcell_port_t port; /*!< Server port number */
+        } server;              /*!< Server status change. Use with \ref LWCELL_EVT_SERVER event */
+#endif                         /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
 #endif               /* LWCELL_CFG_CONN || __DOXYGEN__ */
 
 #if LWCELL_CFG_SMS || __DOXYGEN__
@@ -523,6 +831,21 @@ typedef struct lwcell_evt {
             size_t size;                /*!< Number of valid entries */
             lwcellr_t res;               /*!< Result on command */
         } sms_list;                     /*!< SMS list. Use with \ref LWCELL_EVT_SMS_LIST event */
+#if LWCELL_CFG_SMS_DIRECT || __DOXYGEN__
+        struct {
+            const lwcell_sms_entry_t* entry; /*!< Received message, valid only during event callback */
+            lwcellr_t ack_res;               /*!< Result of queuing `AT+CNMA` acknowledge, \ref lwcellOK when not used */
+        } sms_deliver;                      /*!< SMS received directly. Use with \ref LWCELL_EVT_SMS_DELIVER event */
+#endif                                      /* LWCELL_CFG_SMS_DIRECT || __DOXYGEN__ */
+#if LWCELL_CFG_SMS_BULK || __DOXYGEN__
+        struct {
+            lwcell_sms_bulk_t* job; /*!< Bulk SMS job */
+            size_t idx;             /*!< Index of processed recipient */
+            lwcellr_t res;          /*!< Recipient send result */
+            size_t pos;             /*!< Message reference on success */
+            uint8_t done;           /*!< Set to `1` when job has finished, `idx` and `res` are not valid */
+        } sms_bulk;                 /*!< Bulk SMS job. Use with \ref LWCELL_EVT_SMS_BULK event */
+#endif                              /* LWCELL_CFG_SMS_BULK || __DOXYGEN__ */
 #endif                                  /* LWCELL_CFG_SMS || __DOXYGEN__ */
 #if LWCELL_CFG_CALL || __DOXYGEN__
         struct {
@@ -644,6 +967,19 @@ typedef struct {
  */
 typedef void (*lwcell_api_cmd_evt_fn)(lwcellr_t res, void* arg);
 
+struct lwcell_msg;
+
+/**
+ * \ingroup         LWCELL_TYPES
+ * \brief           Command handle to cancel command or to set its deadline
+ * \note            Handle must stay valid until linked command finishes.
+ *                  Used only when \ref LWCELL_CFG_CMD_HANDLE is enabled
+ */
+typedef struct {
+    struct lwcell_msg* msg; /*!< Linked command, set and cleared by stack. `NULL` when command finished */
+    uint32_t timeout;       /*!< Deadline in units of milliseconds since command was queued, `0` for default */
+} lwcell_cmd_handle_t;
+
 /**
  * \ingroup         LWCELL_UNICODE
  * \brief           Unicode support structure
@@ -74,6 +74,36 @@ prv_keep_alive_timeout_fn(void* arg) {
 
 #endif /* LWCELL_CFG_KEEP_ALIVE */
 
+#if LWCELL_CFG_PIPE_STATS
+
+/**
+ * \brief           Copy input counters to pipeline statistics
+ */
+static void
+prv_pipe_stats_update(void) {
+    lwcelli_input_get_stats(&lwcell.pipe.recv_len, &lwcell.pipe.recv_calls);
+}
+
+#if LWCELL_CFG_PIPE_STATS_EVT_INTERVAL > 0
+
+/**
+ * \brief           Pipeline statistics timeout callback function
+ * \param[in]       arg: Custom user argument
+ */
+static void
+prv_pipe_stats_timeout_fn(void* arg) {
+    prv_pipe_stats_update();
+    lwcell.evt.evt.pipe_stats.stats = &lwcell.pipe;
+    lwcelli_send_cb(LWCELL_EVT_PIPE_STATS);
+
+    /* Start new timeout */
+    lwcell_timeout_add(LWCELL_CFG_PIPE_STATS_EVT_INTERVAL, prv_pipe_stats_timeout_fn, arg);
+}
+
+#endif /* LWCELL_CFG_PIPE_STATS_EVT_INTERVAL > 0 */
+
+#endif /* LWCELL_CFG_PIPE_STATS */
+
 /**
  * \brief           Init and prepare GSM stack for device operation
  * \note            Function must be called from operating system thread context.
@@ -155,6 +185,12 @@ lwcell_init(lwcell_evt_fn evt_func, const uint32_t blocking) {
     /* Register keep-alive events */
     lwcell_timeout_add(LWCELL_CFG_KEEP_ALIVE_TIMEOUT, prv_keep_alive_timeout_fn, NULL);
 #endif /* LWCELL_CFG_KEEP_ALIVE */
+#if LWCELL_CFG_PIPE_STATS
+    lwcell.pipe.since = lwcell_sys_now();
+#if LWCELL_CFG_PIPE_STATS_EVT_INTERVAL > 0
+    lwcell_timeout_add(LWCELL_CFG_PIPE_STATS_EVT_INTERVAL, prv_pipe_stats_timeout_fn, NULL);
+#endif /* LWCELL_CFG_PIPE_STATS_EVT_INTERVAL > 0 */
+#endif /* LWCELL_CFG_PIPE_STATS */
 
     /*
      * Call reset command and call default
@@ -237,6 +273,11 @@ lwcellr_t
 lwcell_core_lock(void) {
     lwcell_sys_protect();
     ++lwcell.locked_cnt;
+#if LWCELL_CFG_PIPE_STATS
+    if (lwcell.locked_cnt == 1) {
+        lwcell.pipe_lock_time = lwcell_sys_now();
+    }
+#endif /* LWCELL_CFG_PIPE_STATS */
     return lwcellOK;
 }
 
@@ -252,6 +293,11 @@ lwcell_core_lock(void) {
  */
 lwcellr_t
 lwcell_core_unlock(void) {
+#if LWCELL_CFG_PIPE_STATS
+    if (lwcell.locked_cnt == 1) {
+        lwcelli_pipe_hist_add(&lwcell.pipe.lock, lwcell_sys_now() - lwcell.pipe_lock_time);
+    }
+#endif /* LWCELL_CFG_PIPE_STATS */
     --lwcell.locked_cnt;
     lwcell_sys_unprotect();
     return lwcellOK;
@@ -282,6 +328,44 @@ lwcell_delay(uint32_t ms) {
     return 0;
 }
 
+#if LWCELL_CFG_CMD_HANDLE || __DOXYGEN__
+
+/**
+ * \brief           Cancel command linked with handle
+ *
+ * Command waiting in queue is dropped and finishes with \ref lwcellERR without being sent to device,
+ * blocking caller returns immediately.
+ * Command in execution is aborted only where device allows it safely,
+ * operator scan is aborted with single character and SMS send is discarded with escape at `> ` prompt.
+ *
+ * \param[in]       h: Handle passed to `_with_handle` API function
+ * \return          \ref lwcellOK on success, \ref lwcellERR if command already finished or cannot be aborted
+ */
+lwcellr_t
+lwcell_cmd_cancel(lwcell_cmd_handle_t* h) {
+    lwcellr_t res = lwcellERR;
+
+    LWCELL_ASSERT(h != NULL);
+
+    lwcell_core_lock();
+    if (h->msg != NULL) {
+        if (h->msg != lwcell.msg) {
+            h->msg->cancel = 1; /* Dropped when taken from queue */
+            if (h->msg->is_blocking && !h->msg->detached) {
+                h->msg->detached = 1; /* Blocking caller returns immediately */
+                lwcell_sys_sem_release(&h->msg->sem);
+            }
+            res = lwcellOK;
+        } else if (lwcelli_cmd_abort(h->msg)) {
+            res = lwcellOK;
+        }
+    }
+    lwcell_core_unlock();
+    return res;
+}
+
+#endif /* LWCELL_CFG_CMD_HANDLE || __DOXYGEN__ */
+
 /**
  * \brief           Set modem function mode
  * \note            Use this function to set modem to normal or low-power mode
@@ -358,3 +442,83 @@ lwcell_device_is_present(void) {
     lwcell_core_unlock();
     return res;
 }
+
+#if LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+
+/**
+ * \brief           Add sample to pipeline statistics histogram
+ * \param[in]       h: Histogram to update
+ * \param[in]       ms: Sample in units of milliseconds
+ */
+void
+lwcelli_pipe_hist_add(lwcell_pipe_hist_t* h, uint32_t ms) {
+    size_t i = 0;
+
+    if (ms > h->max) {
+        h->max = ms;
+    }
+    for (; ms > 0 && i < LWCELL_CFG_PIPE_STATS_BUCKETS - 1; ++i) {
+        ms >>= 2; /* Buckets grow by factor of 4 */
+    }
+    if (h->bucket[i] < 0xFFFF) {
+        ++h->bucket[i];
+    }
+}
+
+/**
+ * \brief           Get pipeline statistics
+ * \param[out]      stats: Pointer to output structure to fill
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_pipe_get_stats(lwcell_pipe_stats_t* stats) {
+    LWCELL_ASSERT(stats != NULL);
+
+    lwcell_core_lock();
+    prv_pipe_stats_update();
+    LWCELL_MEMCPY(stats, &lwcell.pipe, sizeof(*stats));
+    lwcell_core_unlock();
+    return lwcellOK;
+}
+
+/**
+ * \brief           Get pipeline statistics of single command type
+ *
+ * Application may iterate command types from `0` until function returns \ref lwcellERRPAR.
+ * Command type names are available in debug output of the stack.
+ *
+ * \param[in]       cmd: Command type index
+ * \param[out]      stats: Pointer to output structure to fill
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_pipe_get_cmd_stats(size_t cmd, lwcell_pipe_cmd_stats_t* stats) {
+    LWCELL_ASSERT(cmd < LWCELL_CMD_END);
+    LWCELL_ASSERT(stats != NULL);
+
+    lwcell_core_lock();
+    LWCELL_MEMCPY(stats, &lwcell.pipe_cmd[cmd], sizeof(*stats));
+    lwcell_core_unlock();
+    return lwcellOK;
+}
+
+/**
+ * \brief           Reset pipeline statistics
+ * \note            Number of commands waiting for execution is kept,
+ *                  its high-watermark is set to current value.
+ *                  Input counters are never reset
+ */
+void
+lwcell_pipe_reset_stats(void) {
+    size_t depth;
+
+    lwcell_core_lock();
+    depth = lwcell.pipe.queue_depth;
+    LWCELL_MEMSET(&lwcell.pipe, 0x00, sizeof(lwcell.pipe));
+    LWCELL_MEMSET(lwcell.pipe_cmd, 0x00, sizeof(lwcell.pipe_cmd));
+    lwcell.pipe.queue_depth = lwcell.pipe.queue_depth_max = depth;
+    lwcell.pipe.since = lwcell_sys_now();
+    lwcell_core_unlock();
+}
+
+#endif /* LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
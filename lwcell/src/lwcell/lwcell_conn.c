@@ -53,6 +53,35 @@
         }                                                                                                              \
     } while (0)
 
+/**
+ * \brief           Mark connection write as failed due to memory,
+ *                  to notify application when memory may be available again
+ * \param[in]       conn: Connection handle
+ */
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH
+#define CONN_WRITE_SET_BLOCKED(conn) (conn)->status.f.write_blocked = 1
+#else /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH */
+#define CONN_WRITE_SET_BLOCKED(conn)
+#endif /* !LWCELL_CFG_CONN_WRITE_AUTO_FLUSH */
+
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__
+
+/**
+ * \brief           Send writable event if previous write failed due to memory
+ * \param[in]       conn: Connection handle
+ */
+static void
+conn_writable_check(lwcell_conn_p conn) {
+    if (conn->status.f.write_blocked && conn->status.f.active) {
+        conn->status.f.write_blocked = 0;
+        lwcell.evt.type = LWCELL_EVT_CONN_WRITABLE;
+        lwcell.evt.evt.conn_writable.conn = conn;
+        lwcelli_send_conn_cb(conn, NULL);
+    }
+}
+
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__ */
+
 /**
  * \brief           Timeout callback for connection
  * \param[in]       arg: Timeout callback custom argument
@@ -66,6 +95,21 @@ conn_timeout_cb(void* arg) {
         lwcell.evt.evt.conn_poll.conn = conn;   /* Set connection pointer */
         lwcelli_send_conn_cb(conn, NULL);       /* Send connection callback */
 
+#if LWCELL_CFG_CONN_STATS && LWCELL_CFG_CONN_STATS_EVT_INTERVAL > 0
+        conn->stats_evt_time += LWCELL_CFG_CONN_POLL_INTERVAL;
+        if (conn->status.f.active && conn->stats_evt_time >= LWCELL_CFG_CONN_STATS_EVT_INTERVAL) {
+            conn->stats_evt_time = 0;
+            lwcell.evt.type = LWCELL_EVT_CONN_STATS; /* Periodic statistics event */
+            lwcell.evt.evt.conn_stats.conn = conn;
+            lwcell.evt.evt.conn_stats.stats = &conn->stats;
+            lwcelli_send_conn_cb(conn, NULL);
+        }
+#endif /* LWCELL_CFG_CONN_STATS && LWCELL_CFG_CONN_STATS_EVT_INTERVAL > 0 */
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH
+        /* Memory may have been released by received data or other connections meanwhile */
+        conn_writable_check(conn);
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH */
+
         lwcelli_conn_start_timeout(conn);       /* Schedule new timeout */
         LWCELL_DEBUGF(LWCELL_CFG_DBG_CONN | LWCELL_DBG_TYPE_TRACE, "[LWCELL CONN] Poll event: %p\r\n", (void*)conn);
     }
@@ -80,6 +124,67 @@ lwcelli_conn_start_timeout(lwcell_conn_p conn) {
     lwcell_timeout_add(LWCELL_CFG_CONN_POLL_INTERVAL, conn_timeout_cb, conn); /* Add connection timeout */
 }
 
+#if LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__
+
+/**
+ * \brief           Send read command for received data to producer queue
+ * \param[in]       conn: Connection handle
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+static lwcellr_t
+conn_manual_rx_send(lwcell_conn_p conn) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    LWCELL_MSG_VAR_ALLOC(msg, 0);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CIPRXGET;
+    LWCELL_MSG_VAR_REF(msg).msg.conn_recv.conn = conn;
+    LWCELL_MSG_VAR_REF(msg).msg.conn_recv.val_id = conn->val_id;
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 1000);
+}
+
+/**
+ * \brief           Start reading received data from device buffer in manual receive mode
+ *
+ * Read command is sent to producer queue when device has data for connection,
+ * receive window is not full and no other read is pending for this connection
+ *
+ * \note            Function must be called with core locked
+ * \param[in]       conn: Connection handle
+ */
+void
+lwcelli_conn_manual_rx_start(lwcell_conn_p conn) {
+    if (!conn->status.f.active || conn->status.f.in_closing || !conn->status.f.rx_avail
+        || conn->status.f.rx_read_queued || conn->rx_unacked >= LWCELL_CFG_CONN_MANUAL_RX_WINDOW) {
+        return;
+    }
+    if (conn_manual_rx_send(conn) == lwcellOK) {
+        conn->status.f.rx_read_queued = 1;
+    } else {
+        lwcelli_conn_manual_rx_retry(conn); /* Queue is full or no memory, try again later */
+    }
+}
+
+/**
+ * \brief           Timeout callback to retry reading received data
+ * \param[in]       arg: Timeout callback custom argument
+ */
+static void
+conn_manual_rx_retry_cb(void* arg) {
+    lwcelli_conn_manual_rx_start(arg); /* Argument is actual connection */
+}
+
+/**
+ * \brief           Schedule new attempt to read received data from device buffer
+ * \param[in]       conn: Connection handle
+ */
+void
+lwcelli_conn_manual_rx_retry(lwcell_conn_p conn) {
+    lwcell_timeout_add(LWCELL_CFG_CONN_MANUAL_RX_RETRY_TIME, conn_manual_rx_retry_cb, conn);
+}
+
+#endif /* LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__ */
+
 /**
  * \brief           Get connection validation ID
  * \param[in]       conn: Connection handle
@@ -95,6 +200,63 @@ lwcelli_conn_get_val_id(lwcell_conn_p conn) {
     return val_id;
 }
 
+#if LWCELL_CFG_CONN_TX_COALESCE || __DOXYGEN__
+
+/**
+ * \brief           Try to merge send request to last queued send request on the same connection
+ *
+ * Request is merged when it is small TCP send and last queued request has not been sent to device yet.
+ * When merged, request data are copied and message is finished by the leading request.
+ * Otherwise request becomes new leading request, if it may be merged with later requests.
+ *
+ * \param[in]       msg: Send message to merge
+ * \return          `1` if merged, `0` otherwise
+ */
+static uint8_t
+conn_send_coalesce(lwcell_msg_t* msg) {
+    lwcell_conn_p conn = msg->msg.conn_send.conn;
+    lwcell_msg_t *leader, *tail;
+    uint8_t merged = 0, can_merge;
+
+    can_merge = msg->msg.conn_send.remote_ip == NULL && conn->type != LWCELL_CONN_TYPE_UDP
+                && msg->msg.conn_send.btw < LWCELL_CFG_CONN_MAX_DATA_LEN;
+
+    lwcell_core_lock();
+    leader = conn->tx_leader;
+    if (can_merge && leader != NULL && leader->msg.conn_send.val_id == msg->msg.conn_send.val_id
+        && (leader->msg.conn_send.btw + leader->msg.conn_send.merge_len + msg->msg.conn_send.btw)
+               <= LWCELL_CFG_CONN_MAX_DATA_LEN
+        && !(msg->is_blocking && lwcell.locked_cnt > 1)) {
+        if (leader->msg.conn_send.merge_buff == NULL) {
+            leader->msg.conn_send.merge_buff =
+                LWCELL_MEM_MALLOC(sizeof(uint8_t) * LWCELL_CFG_CONN_MAX_DATA_LEN, LWCELL_MEM_TAG_CONN_BUFF);
+        }
+        if (leader->msg.conn_send.merge_buff != NULL && (!msg->is_blocking || lwcell_sys_sem_create(&msg->sem, 0))) {
+            LWCELL_MEMCPY(&leader->msg.conn_send.merge_buff[leader->msg.conn_send.btw + leader->msg.conn_send.merge_len],
+                          msg->msg.conn_send.data, msg->msg.conn_send.btw);
+            leader->msg.conn_send.merge_len += msg->msg.conn_send.btw;
+            if (msg->msg.conn_send.fau) {
+                msg->msg.conn_send.fau = 0;
+                lwcell_mem_free_s((void**)&msg->msg.conn_send.data);
+            }
+            msg->msg.conn_send.data = NULL;
+
+            /* Add to the end of merged requests to keep order of events */
+            for (tail = leader; tail->msg.conn_send.next != NULL; tail = tail->msg.conn_send.next) {}
+            tail->msg.conn_send.next = msg;
+            merged = 1;
+        }
+    }
+    if (!merged) {
+        /* Requests after this one may never overtake it */
+        conn->tx_leader = can_merge ? msg : NULL;
+    }
+    lwcell_core_unlock();
+    return merged;
+}
+
+#endif /* LWCELL_CFG_CONN_TX_COALESCE || __DOXYGEN__ */
+
 /**
  * \brief           Send data on already active connection of type UDP to specific remote IP and port
  * \note            In case IP and port values are not set, it will behave as normal send function (suitable for TCP too)
@@ -135,6 +297,18 @@ conn_send(lwcell_conn_p conn, const lwcell_ip_t* const ip, lwcell_port_t port, c
     LWCELL_MSG_VAR_REF(msg).msg.conn_send.fau = fau;
     LWCELL_MSG_VAR_REF(msg).msg.conn_send.val_id = lwcelli_conn_get_val_id(conn);
 
+#if LWCELL_CFG_CONN_TX_COALESCE
+    if (conn_send_coalesce(&LWCELL_MSG_VAR_REF(msg))) {
+        lwcellr_t res = lwcellOK;
+        if (blocking) { /* Wait for leading request to finish */
+            lwcell_sys_sem_wait(&LWCELL_MSG_VAR_REF(msg).sem, 0);
+            res = LWCELL_MSG_VAR_REF(msg).res;
+            LWCELL_MSG_VAR_FREE(msg);
+        }
+        return res;
+    }
+#endif /* LWCELL_CFG_CONN_TX_COALESCE */
+
     return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 60000);
 }
 
@@ -175,19 +349,20 @@ void
 lwcelli_conn_init(void) {}
 
 /**
- * \brief           Start a new connection of specific type
+ * \brief           Queue connection start command
  * \param[out]      conn: Pointer to connection handle to set new connection reference in case of successful connection
  * \param[in]       type: Connection type. This parameter can be a value of \ref lwcell_conn_type_t enumeration
  * \param[in]       host: Connection host. In case of IP, write it as string, ex. "192.168.1.1"
  * \param[in]       port: Connection port
  * \param[in]       arg: Pointer to user argument passed to connection if successfully connected
  * \param[in]       conn_evt_fn: Callback function for this connection
+ * \param[in]       h: Command handle to link, `NULL` when not used
  * \param[in]       blocking: Status whether command should be blocking or not
  * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
  */
-lwcellr_t
-lwcell_conn_start(lwcell_conn_p* conn, lwcell_conn_type_t type, const char* const host, lwcell_port_t port,
-                  void* const arg, lwcell_evt_fn conn_evt_fn, const uint32_t blocking) {
+static lwcellr_t
+prv_conn_start(lwcell_conn_p* conn, lwcell_conn_type_t type, const char* const host, lwcell_port_t port,
+               void* const arg, lwcell_evt_fn conn_evt_fn, lwcell_cmd_handle_t* h, const uint32_t blocking) {
     LWCELL_MSG_VAR_DEFINE(msg);
 
     LWCELL_ASSERT(host != NULL);
@@ -195,6 +370,7 @@ lwcell_conn_start(lwcell_conn_p* conn, lwcell_conn_type_t type, const char* cons
     LWCELL_ASSERT(conn_evt_fn != NULL);
 
     LWCELL_MSG_VAR_ALLOC(msg, blocking);
+    LWCELL_MSG_VAR_SET_HANDLE(msg, h);
     LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CIPSTART;
     LWCELL_MSG_VAR_REF(msg).cmd = LWCELL_CMD_CIPSTATUS;
     LWCELL_MSG_VAR_REF(msg).msg.conn_start.num = LWCELL_CFG_MAX_CONNS; /* Set maximal value as invalid number */
@@ -208,6 +384,51 @@ lwcell_conn_start(lwcell_conn_p* conn, lwcell_conn_type_t type, const char* cons
     return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 60000);
 }
 
+/**
+ * \brief           Start a new connection of specific type
+ * \param[out]      conn: Pointer to connection handle to set new connection reference in case of successful connection
+ * \param[in]       type: Connection type. This parameter can be a value of \ref lwcell_conn_type_t enumeration
+ * \param[in]       host: Connection host. In case of IP, write it as string, ex. "192.168.1.1"
+ * \param[in]       port: Connection port
+ * \param[in]       arg: Pointer to user argument passed to connection if successfully connected
+ * \param[in]       conn_evt_fn: Callback function for this connection
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_conn_start(lwcell_conn_p* conn, lwcell_conn_type_t type, const char* const host, lwcell_port_t port,
+                  void* const arg, lwcell_evt_fn conn_evt_fn, const uint32_t blocking) {
+    return prv_conn_start(conn, type, host, port, arg, conn_evt_fn, NULL, blocking);
+}
+
+#if LWCELL_CFG_CMD_HANDLE || __DOXYGEN__
+
+/**
+ * \brief           Start a new connection of specific type with command handle
+ *
+ * Same as \ref lwcell_conn_start, handle may set deadline of connection start
+ * and drop it with \ref lwcell_cmd_cancel while it waits in queue
+ *
+ * \param[out]      conn: Pointer to connection handle to set new connection reference in case of successful connection
+ * \param[in]       type: Connection type. This parameter can be a value of \ref lwcell_conn_type_t enumeration
+ * \param[in]       host: Connection host. In case of IP, write it as string, ex. "192.168.1.1"
+ * \param[in]       port: Connection port
+ * \param[in]       arg: Pointer to user argument passed to connection if successfully connected
+ * \param[in]       conn_evt_fn: Callback function for this connection
+ * \param[in]       h: Command handle with `timeout` member set. It must stay valid until command finishes
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_conn_start_with_handle(lwcell_conn_p* conn, lwcell_conn_type_t type, const char* const host,
+                              lwcell_port_t port, void* const arg, lwcell_evt_fn conn_evt_fn, lwcell_cmd_handle_t* h,
+                              const uint32_t blocking) {
+    LWCELL_ASSERT(h != NULL);
+    return prv_conn_start(conn, type, host, port, arg, conn_evt_fn, h, blocking);
+}
+
+#endif /* LWCELL_CFG_CMD_HANDLE || __DOXYGEN__ */
+
 /**
  * \brief           Close specific or all connections
  * \param[in]       conn: Connection handle to close. Set to NULL if you want to close all connections.
@@ -226,11 +447,19 @@ lwcell_conn_close(lwcell_conn_p conn, const uint32_t blocking) {
     /* Proceed with close event at this point! */
     LWCELL_MSG_VAR_ALLOC(msg, blocking);
     LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CIPCLOSE;
+#if LWCELL_CFG_CONN_TRANSPARENT
+    LWCELL_MSG_VAR_REF(msg).cmd = LWCELL_CMD_PPP; /* Escape data mode first */
+#endif                                          /* LWCELL_CFG_CONN_TRANSPARENT */
     LWCELL_MSG_VAR_REF(msg).msg.conn_close.conn = conn;
     LWCELL_MSG_VAR_REF(msg).msg.conn_close.val_id = lwcelli_conn_get_val_id(conn);
 
-    flush_buff(conn);                   /* First flush buffer */
+    flush_buff(conn); /* First flush buffer */
+#if LWCELL_CFG_CONN_TRANSPARENT
+    res = lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd,
+                                            2 * LWCELL_CFG_CONN_TRANSPARENT_GUARD_TIME + 1000);
+#else  /* LWCELL_CFG_CONN_TRANSPARENT */
     res = lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 1000);
+#endif /* !LWCELL_CFG_CONN_TRANSPARENT */
     if (res == lwcellOK && !blocking) { /* Function succedded in non-blocking mode */
         lwcell_core_lock();
         LWCELL_DEBUGF(LWCELL_CFG_DBG_CONN | LWCELL_DBG_TYPE_TRACE,
@@ -305,10 +534,11 @@ lwcell_conn_send(lwcell_conn_p conn, const void* data, size_t btw, size_t* const
  *
  * Once data reception is confirmed, stack will try to send more data to user.
  *
- * \note            Since this feature is not supported yet by AT commands, function is only prototype
- *                  and should be used in connection callback when data are received
- *
- * \note            Function is not thread safe and may only be called from connection event function
+ * \note            When \ref LWCELL_CFG_CONN_MANUAL_RX is enabled and manual confirmation is set
+ *                  with \ref lwcell_conn_set_rx_manual_ack, function opens receive window
+ *                  and may be called from any thread after application processed the data.
+ *                  Connection stops receiving when \ref LWCELL_CFG_CONN_MANUAL_RX_WINDOW bytes are not confirmed.
+ *                  Otherwise function is only prototype and should be used in connection callback when data are received
  *
  * \param[in]       conn: Connection handle
  * \param[in]       pbuf: Packet buffer received on connection
@@ -316,11 +546,55 @@ lwcell_conn_send(lwcell_conn_p conn, const void* data, size_t btw, size_t* const
  */
 lwcellr_t
 lwcell_conn_recved(lwcell_conn_p conn, lwcell_pbuf_p pbuf) {
+#if LWCELL_CFG_CONN_MANUAL_RX
+    size_t len;
+
+    LWCELL_ASSERT(conn != NULL);
+    LWCELL_ASSERT(pbuf != NULL);
+
+    len = lwcell_pbuf_length(pbuf, 1);
+    lwcell_core_lock();
+    conn->rx_unacked -= LWCELL_MIN(conn->rx_unacked, len);
+    lwcelli_conn_manual_rx_start(conn); /* Read more data if device has them */
+    lwcell_core_unlock();
+#else  /* LWCELL_CFG_CONN_MANUAL_RX */
     LWCELL_UNUSED(conn);
     LWCELL_UNUSED(pbuf);
+#endif /* !LWCELL_CFG_CONN_MANUAL_RX */
     return lwcellOK;
 }
 
+#if LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__
+
+/**
+ * \brief           Enable or disable manual confirmation of received data for connection
+ *
+ * When disabled (default), data are confirmed automatically when connection callback returns.
+ * When enabled, application must call \ref lwcell_conn_recved for every received buffer,
+ * otherwise connection stops receiving after \ref LWCELL_CFG_CONN_MANUAL_RX_WINDOW bytes
+ *
+ * \note            Setting is reset each time connection becomes active.
+ *                  Call it from \ref LWCELL_EVT_CONN_ACTIVE event, before any data are received
+ * \param[in]       conn: Connection handle
+ * \param[in]       en: Set to `1` to enable manual confirmation, `0` to confirm automatically
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_conn_set_rx_manual_ack(lwcell_conn_p conn, uint8_t en) {
+    LWCELL_ASSERT(conn != NULL);
+
+    lwcell_core_lock();
+    conn->status.f.rx_manual_ack = LWCELL_U8(en > 0);
+    if (!en) {
+        conn->rx_unacked = 0;               /* Everything received so far is now confirmed */
+        lwcelli_conn_manual_rx_start(conn); /* Read more data if device has them */
+    }
+    lwcell_core_unlock();
+    return lwcellOK;
+}
+
+#endif /* LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__ */
+
 /**
  * \brief           Set argument variable for connection
  * \param[in]       conn: Connection handle to set argument
@@ -351,6 +625,53 @@ lwcell_conn_get_arg(lwcell_conn_p conn) {
     return arg;
 }
 
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+
+/**
+ * \brief           Enable or disable server mode to accept incoming TCP connections
+ *
+ * Accepted connections use `server_evt_fn` callback function
+ * and report \ref LWCELL_EVT_CONN_ACTIVE event with client flag cleared.
+ * \ref LWCELL_EVT_SERVER event is sent when server status changes.
+ *
+ * \note            Device must be attached to network before server is enabled
+ * \param[in]       en: Set to `1` to enable server, `0` to disable it
+ * \param[in]       port: Local port to listen on. Used only when server is enabled
+ * \param[in]       server_evt_fn: Callback function for accepted connections. Used only when server is enabled
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_conn_set_server(uint8_t en, lwcell_port_t port, lwcell_evt_fn server_evt_fn, const uint32_t blocking) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    LWCELL_ASSERT(!en || port > 0);
+    LWCELL_ASSERT(!en || server_evt_fn != NULL);
+
+    LWCELL_MSG_VAR_ALLOC(msg, blocking);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CIPSERVER;
+    LWCELL_MSG_VAR_REF(msg).msg.tcpip_server.en = en;
+    LWCELL_MSG_VAR_REF(msg).msg.tcpip_server.port = port;
+    LWCELL_MSG_VAR_REF(msg).msg.tcpip_server.evt_func = server_evt_fn;
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 10000);
+}
+
+/**
+ * \brief           Check if server is listening for incoming connections
+ * \return          `1` if active, `0` otherwise
+ */
+uint8_t
+lwcell_conn_is_server_active(void) {
+    uint8_t res;
+    lwcell_core_lock();
+    res = lwcell.m.server_active;
+    lwcell_core_unlock();
+    return res;
+}
+
+#endif /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
+
 /**
  * \brief           Gets connections status
  * \param[in]       blocking: Status whether command should be blocking or not
@@ -442,10 +763,103 @@ lwcell_conn_get_from_evt(lwcell_evt_t* evt) {
         case LWCELL_EVT_CONN_RECV: return lwcell_evt_conn_recv_get_conn(evt);
         case LWCELL_EVT_CONN_SEND: return lwcell_evt_conn_send_get_conn(evt);
         case LWCELL_EVT_CONN_POLL: return lwcell_evt_conn_poll_get_conn(evt);
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH
+        case LWCELL_EVT_CONN_WRITABLE: return lwcell_evt_conn_writable_get_conn(evt);
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH */
+#if LWCELL_CFG_CONN_STATS
+        case LWCELL_EVT_CONN_STATS: return lwcell_evt_conn_stats_get_conn(evt);
+#endif /* LWCELL_CFG_CONN_STATS */
         default: return NULL;
     }
 }
 
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__
+
+/**
+ * \brief           Timeout callback to send connection write buffer after delay expired
+ * \param[in]       arg: Connection handle
+ */
+static void
+conn_write_flush_cb(void* arg) {
+    lwcell_conn_p conn = arg;
+    uint32_t diff;
+
+    if (!conn->status.f.write_flush_armed) {
+        return;
+    }
+    conn->status.f.write_flush_armed = 0;
+    if (!conn->status.f.active || conn->buff.buff == NULL || conn->buff.ptr == 0) {
+        return;
+    }
+
+    /* Buffer may have been sent and started again since timeout was scheduled */
+    diff = lwcell_sys_now() - conn->write_flush_start;
+    if (diff >= conn->write_flush_time) {
+        LWCELL_DEBUGF(LWCELL_CFG_DBG_CONN | LWCELL_DBG_TYPE_TRACE, "[LWCELL CONN] Auto flush %d bytes on conn %d\r\n",
+                      (int)conn->buff.ptr, (int)conn->num);
+        flush_buff(conn);
+    } else {
+        conn->status.f.write_flush_armed = 1;
+        lwcell_timeout_add(conn->write_flush_time - diff, conn_write_flush_cb, conn);
+    }
+}
+
+/**
+ * \brief           Send write buffer when it reached size threshold,
+ *                  or schedule timeout to send it after delay
+ * \param[in]       conn: Connection handle
+ * \param[in]       restart: Set to `1` when first data were written to current buffer
+ */
+static void
+conn_write_auto_flush(lwcell_conn_p conn, uint8_t restart) {
+    if (conn->write_flush_size > 0 && conn->buff.ptr >= conn->write_flush_size) {
+        flush_buff(conn);
+    } else if (conn->write_flush_time > 0) {
+        if (restart) {
+            conn->write_flush_start = lwcell_sys_now();
+        }
+        if (!conn->status.f.write_flush_armed) {
+            conn->status.f.write_flush_armed = 1;
+            lwcell_timeout_add(conn->write_flush_time, conn_write_flush_cb, conn);
+        }
+    }
+}
+
+/**
+ * \brief           Send writable event to all connections which write failed due to memory
+ * \note            Function is called from core after data were sent on any connection,
+ *                  as released send memory may be used by any of them
+ */
+void
+lwcelli_conn_writable_check(void) {
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(lwcell.m.conns); ++i) {
+        conn_writable_check(&lwcell.m.conns[i]);
+    }
+}
+
+/**
+ * \brief           Set automatic flush parameters for connection write buffer
+ * \param[in]       conn: Connection handle
+ * \param[in]       time: Delay in units of milliseconds after first byte in write buffer before it is sent.
+ *                      Set to `0` to disable time based flush
+ * \param[in]       size: Number of bytes in write buffer to send it immediately.
+ *                      Set to `0` to send buffer only when full or when delay expires
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ * \sa              lwcell_conn_write
+ */
+lwcellr_t
+lwcell_conn_set_write_auto_flush(lwcell_conn_p conn, uint32_t time, size_t size) {
+    LWCELL_ASSERT(conn != NULL);
+
+    lwcell_core_lock();
+    conn->write_flush_time = time;
+    conn->write_flush_size = LWCELL_MIN(size, LWCELL_CFG_CONN_MAX_DATA_LEN);
+    lwcell_core_unlock();
+    return lwcellOK;
+}
+
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__ */
+
 /**
  * \brief           Write data to connection buffer and if it is full, send it non-blocking way
  * \note            This function may only be called from core (connection callbacks)
@@ -463,9 +877,16 @@ lwcellr_t
 lwcell_conn_write(lwcell_conn_p conn, const void* data, size_t btw, uint8_t flush, size_t* const mem_available) {
     size_t len;
     const uint8_t* d = data;
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH
+    const uint8_t* buff_start;
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH */
 
     LWCELL_ASSERT(conn != NULL);
 
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH
+    buff_start = conn->buff.ptr > 0 ? conn->buff.buff : NULL; /* Buffer pending before this call */
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH */
+
     /*
      * Steps during write process:
      *
@@ -503,16 +924,18 @@ lwcell_conn_write(lwcell_conn_p conn, const void* data, size_t btw, uint8_t flus
     /* Step 2 */
     while (btw >= LWCELL_CFG_CONN_MAX_DATA_LEN) {
         uint8_t* buff;
-        buff = lwcell_mem_malloc(sizeof(*buff) * LWCELL_CFG_CONN_MAX_DATA_LEN);
+        buff = LWCELL_MEM_MALLOC(sizeof(*buff) * LWCELL_CFG_CONN_MAX_DATA_LEN, LWCELL_MEM_TAG_CONN_BUFF);
         if (buff != NULL) {
             LWCELL_MEMCPY(buff, d, LWCELL_CFG_CONN_MAX_DATA_LEN); /* Copy data to buffer */
             if (conn_send(conn, NULL, 0, buff, LWCELL_CFG_CONN_MAX_DATA_LEN, NULL, 1, 0) != lwcellOK) {
                 LWCELL_DEBUGF(LWCELL_CFG_DBG_CONN | LWCELL_DBG_TYPE_TRACE, "[LWCELL CONN] Free write buffer: %p\r\n",
                               (void*)buff);
                 lwcell_mem_free_s((void**)&buff);
+                CONN_WRITE_SET_BLOCKED(conn);
                 return lwcellERRMEM;
             }
         } else {
+            CONN_WRITE_SET_BLOCKED(conn);
             return lwcellERRMEM;
         }
 
@@ -522,7 +945,8 @@ lwcell_conn_write(lwcell_conn_p conn, const void* data, size_t btw, uint8_t flus
 
     /* Step 3 */
     if (conn->buff.buff == NULL) {
-        conn->buff.buff = lwcell_mem_malloc(sizeof(*conn->buff.buff) * LWCELL_CFG_CONN_MAX_DATA_LEN);
+        conn->buff.buff =
+            LWCELL_MEM_MALLOC(sizeof(*conn->buff.buff) * LWCELL_CFG_CONN_MAX_DATA_LEN, LWCELL_MEM_TAG_CONN_BUFF);
         conn->buff.len = LWCELL_CFG_CONN_MAX_DATA_LEN;
         conn->buff.ptr = 0;
 
@@ -530,6 +954,9 @@ lwcell_conn_write(lwcell_conn_p conn, const void* data, size_t btw, uint8_t flus
                       "[LWCELL CONN] New write buffer allocated, addr = %p\r\n", conn->buff.buff);
         LWCELL_DEBUGW(LWCELL_CFG_DBG_CONN | LWCELL_DBG_TYPE_TRACE, conn->buff.buff == NULL,
                       "[LWCELL CONN] Cannot allocate new write buffer\r\n");
+        if (conn->buff.buff == NULL) {
+            CONN_WRITE_SET_BLOCKED(conn);
+        }
     }
     if (btw > 0) {
         if (conn->buff.buff != NULL) {
@@ -543,6 +970,10 @@ lwcell_conn_write(lwcell_conn_p conn, const void* data, size_t btw, uint8_t flus
     /* Step 4 */
     if (flush && conn->buff.buff != NULL) {
         flush_buff(conn);
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH
+    } else if (conn->buff.buff != NULL && conn->buff.ptr > 0) {
+        conn_write_auto_flush(conn, conn->buff.buff != buff_start);
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH */
     }
 
     /* Calculate number of available memory after write operation */
@@ -574,6 +1005,45 @@ lwcell_conn_get_total_recved_count(lwcell_conn_p conn) {
     return tot;
 }
 
+#if LWCELL_CFG_CONN_STATS || __DOXYGEN__
+
+/**
+ * \brief           Get snapshot of connection transport statistics
+ *
+ * Statistics are reset when connection becomes active
+ *
+ * \param[in]       conn: Connection handle
+ * \param[out]      stats: Pointer to output statistics structure
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_conn_get_stats(lwcell_conn_p conn, lwcell_conn_stats_t* stats) {
+    LWCELL_ASSERT(conn != NULL);
+    LWCELL_ASSERT(stats != NULL);
+
+    lwcell_core_lock();
+    LWCELL_MEMCPY(stats, &conn->stats, sizeof(*stats));
+    lwcell_core_unlock();
+    return lwcellOK;
+}
+
+/**
+ * \brief           Reset connection transport statistics
+ * \param[in]       conn: Connection handle
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_conn_reset_stats(lwcell_conn_p conn) {
+    LWCELL_ASSERT(conn != NULL);
+
+    lwcell_core_lock();
+    LWCELL_MEMSET(&conn->stats, 0x00, sizeof(conn->stats));
+    lwcell_core_unlock();
+    return lwcellOK;
+}
+
+#endif /* LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
+
 /**
  * \brief           Get connection remote IP address
  * \param[in]       conn: Connection handle
@@ -623,4 +1093,59 @@ lwcell_conn_get_local_port(lwcell_conn_p conn) {
     return port;
 }
 
+#if LWCELL_CFG_CONN_TRANSPARENT || __DOXYGEN__
+
+/**
+ * \brief           Escape transparent data mode and switch modem to command mode
+ *
+ * Connection stays open, data received meanwhile is buffered by the modem.
+ * Use \ref lwcell_conn_transparent_resume to continue with data transfer
+ *
+ * \note            Function waits guard time before and after escape sequence,
+ *                      as set by \ref LWCELL_CFG_CONN_TRANSPARENT_GUARD_TIME
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_conn_transparent_escape(const uint32_t blocking) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    LWCELL_MSG_VAR_ALLOC(msg, blocking);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_PPP;
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd,
+                                             2 * LWCELL_CFG_CONN_TRANSPARENT_GUARD_TIME + 1000);
+}
+
+/**
+ * \brief           Resume transparent data mode after \ref lwcell_conn_transparent_escape
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_conn_transparent_resume(const uint32_t blocking) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    LWCELL_MSG_VAR_ALLOC(msg, blocking);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_ATO;
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 10000);
+}
+
+/**
+ * \brief           Check if modem is currently in transparent data mode
+ * \return          `1` if in data mode, `0` otherwise
+ */
+uint8_t
+lwcell_conn_transparent_is_data_mode(void) {
+    uint8_t res;
+
+    lwcell_core_lock();
+    res = lwcell.m.data_mode;
+    lwcell_core_unlock();
+    return res;
+}
+
+#endif /* LWCELL_CFG_CONN_TRANSPARENT || __DOXYGEN__ */
+
 #endif /* LWCELL_CFG_CONN || __DOXYGEN__ */
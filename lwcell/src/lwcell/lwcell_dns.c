@@ -0,0 +1,303 @@
+/**
+ * \file            lwcell_dns.c
+ * \brief           DNS API
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwCELL - Lightweight cellular modem AT library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v0.1.1
+ */
+#include "lwcell/lwcell_dns.h"
+#include "lwcell/lwcell_private.h"
+#include "lwcell/lwcell_timeout.h"
+
+#if LWCELL_CFG_DNS || __DOXYGEN__
+
+/**
+ * \brief           Single resolved host entry
+ */
+typedef struct {
+    char host[LWCELL_CFG_DNS_HOST_MAX_LEN]; /*!< Host name, empty string for unused entry */
+    lwcell_ip_t ip;                         /*!< Resolved IP address */
+    uint32_t time;                          /*!< Time when address has been resolved */
+    uint32_t last_used;                     /*!< Time when entry was last used by application */
+    uint8_t refreshing;                     /*!< Set to `1` when background refresh has been queued */
+} lwcell_dns_entry_t;
+
+static lwcell_dns_entry_t dns_cache[LWCELL_CFG_DNS_CACHE_SIZE]; /*!< Resolved hosts cache */
+static uint8_t dns_timer_active;                                /*!< Set to `1` when refresh timeout is active */
+
+/**
+ * \brief           Check if entry is still valid
+ * \param[in]       e: Cache entry
+ * \param[in]       now: Current time in units of milliseconds
+ * \return          `1` if valid, `0` otherwise
+ */
+static uint8_t
+dns_entry_is_fresh(const lwcell_dns_entry_t* e, uint32_t now) {
+    return e->host[0] != '\0' && (uint32_t)(now - e->time) < LWCELL_CFG_DNS_CACHE_TTL;
+}
+
+/**
+ * \brief           Find cache entry for host
+ * \param[in]       host: Host name to search for
+ * \return          Pointer to entry on success, `NULL` otherwise
+ */
+static lwcell_dns_entry_t*
+dns_entry_find(const char* host) {
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(dns_cache); ++i) {
+        if (dns_cache[i].host[0] != '\0' && !strcmp(dns_cache[i].host, host)) {
+            return &dns_cache[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Queue background resolve of cached host
+ *
+ * Host name is copied to message, as cache entry may be evicted, flushed or expired
+ * before command is executed
+ *
+ * \param[in]       e: Cache entry to refresh
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+static lwcellr_t
+dns_entry_refresh(const lwcell_dns_entry_t* e) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    LWCELL_MSG_VAR_ALLOC(msg, 0);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CDNSGIP;
+    strcpy(LWCELL_MSG_VAR_REF(msg).msg.dns.host_copy, e->host);
+    LWCELL_MSG_VAR_REF(msg).msg.dns.host = LWCELL_MSG_VAR_REF(msg).msg.dns.host_copy;
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 20000);
+}
+
+/**
+ * \brief           Periodic cache refresh timeout callback
+ *
+ * Entries used by application in last TTL period are resolved again before they expire,
+ * unused expired entries are released
+ *
+ * \param[in]       arg: Custom argument
+ */
+static void
+dns_refresh_timeout(void* arg) {
+    lwcell_dns_entry_t* e;
+    uint32_t now = lwcell_sys_now(), age;
+    uint8_t any_valid = 0;
+
+    LWCELL_UNUSED(arg);
+
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(dns_cache); ++i) {
+        e = &dns_cache[i];
+        if (e->host[0] == '\0') {
+            continue;
+        }
+        age = now - e->time;
+        if (age >= LWCELL_CFG_DNS_CACHE_TTL) {
+            e->refreshing = 0; /* Previous refresh did not succeed in time */
+        }
+        if ((uint32_t)(now - e->last_used) < LWCELL_CFG_DNS_CACHE_TTL) {
+            /* Entry is in use, refresh it before it expires */
+            if (!e->refreshing && age + LWCELL_CFG_DNS_CACHE_REFRESH_TIME >= LWCELL_CFG_DNS_CACHE_TTL) {
+                e->refreshing = dns_entry_refresh(e) == lwcellOK;
+            }
+            any_valid = 1;
+        } else if (age >= LWCELL_CFG_DNS_CACHE_TTL) {
+            e->host[0] = '\0'; /* Entry expired and nobody uses it */
+        } else {
+            any_valid = 1;
+        }
+    }
+
+    /* Keep timer running as long as there is anything to refresh */
+    if (any_valid) {
+        lwcell_timeout_add(LWCELL_CFG_DNS_CACHE_REFRESH_TIME, dns_refresh_timeout, NULL);
+    } else {
+        dns_timer_active = 0;
+    }
+}
+
+/**
+ * \brief           Get IP address from cache and mark entry as used
+ * \note            Core must be locked when calling this function
+ * \param[in]       host: Host name to get IP address for
+ * \param[out]      ip: Pointer to output IP address. Set to `NULL` if not used
+ * \return          `1` if valid entry was found, `0` otherwise
+ */
+uint8_t
+lwcelli_dns_cache_lookup(const char* host, lwcell_ip_t* ip) {
+    lwcell_dns_entry_t* e;
+    uint32_t now = lwcell_sys_now();
+
+    if (host == NULL || (e = dns_entry_find(host)) == NULL) {
+        return 0;
+    }
+    e->last_used = now;
+    if (!dns_entry_is_fresh(e, now)) {
+        return 0;
+    }
+    if (ip != NULL) {
+        LWCELL_MEMCPY(ip, &e->ip, sizeof(*ip));
+    }
+    return 1;
+}
+
+/**
+ * \brief           Check if host shall be resolved before it is used
+ * \note            Core must be locked when calling this function
+ * \param[in]       host: Host name or IP address string
+ * \return          `1` if host shall be resolved, `0` if it is IP address,
+ *                      it cannot be cached or valid cache entry exists
+ */
+uint8_t
+lwcelli_dns_cache_need_resolve(const char* host) {
+    const char* p;
+
+    if (host == NULL || host[0] == '\0' || strlen(host) >= LWCELL_CFG_DNS_HOST_MAX_LEN) {
+        return 0;
+    }
+    for (p = host; *p != '\0' && (LWCELL_CHARISNUM(*p) || *p == '.'); ++p) {}
+    if (*p == '\0') {
+        return 0; /* IP address in string format, nothing to resolve */
+    }
+    return !lwcelli_dns_cache_lookup(host, NULL);
+}
+
+/**
+ * \brief           Save resolved IP address to cache
+ *
+ * Existing entry for the host is updated, otherwise free or least recently used entry is replaced
+ *
+ * \note            Core must be locked when calling this function
+ * \param[in]       host: Host name
+ * \param[in]       ip: Resolved IP address
+ */
+void
+lwcelli_dns_cache_update(const char* host, const lwcell_ip_t* ip) {
+    lwcell_dns_entry_t* e;
+    uint32_t now = lwcell_sys_now();
+
+    if (host == NULL || host[0] == '\0' || strlen(host) >= LWCELL_CFG_DNS_HOST_MAX_LEN) {
+        return;
+    }
+    if ((e = dns_entry_find(host)) == NULL) {
+        e = &dns_cache[0];
+        for (size_t i = 0; i < LWCELL_ARRAYSIZE(dns_cache); ++i) {
+            if (dns_cache[i].host[0] == '\0') {
+                e = &dns_cache[i];
+                break;
+            } else if ((uint32_t)(now - dns_cache[i].last_used) > (uint32_t)(now - e->last_used)) {
+                e = &dns_cache[i];
+            }
+        }
+        strcpy(e->host, host);
+        e->last_used = now;
+    }
+    LWCELL_MEMCPY(&e->ip, ip, sizeof(e->ip));
+    e->time = now;
+    e->refreshing = 0;
+
+    if (!dns_timer_active) {
+        dns_timer_active = lwcell_timeout_add(LWCELL_CFG_DNS_CACHE_REFRESH_TIME, dns_refresh_timeout, NULL) == lwcellOK;
+    }
+}
+
+/**
+ * \brief           Get IP address for host name
+ *
+ * Valid cached address is returned immediately, otherwise `AT+CDNSGIP` command is sent to device
+ * and result is saved to cache for later use, including \ref lwcell_conn_start function
+ *
+ * \param[in]       host: Host name to resolve
+ * \param[out]      ip: Pointer to output IP address. Set to `NULL` to only refresh cache entry
+ * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
+ * \param[in]       evt_arg: Custom argument for event callback function
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_dns_gethostbyname(const char* host, lwcell_ip_t* const ip, const lwcell_api_cmd_evt_fn evt_fn,
+                         void* const evt_arg, const uint32_t blocking) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+    uint8_t cached;
+
+    LWCELL_ASSERT(host != NULL && strlen(host) > 0);
+
+    if (ip != NULL) {
+        lwcell_core_lock();
+        cached = lwcelli_dns_cache_lookup(host, ip);
+        lwcell_core_unlock();
+        if (cached) {
+            if (evt_fn != NULL) {
+                evt_fn(lwcellOK, evt_arg);
+            }
+            return lwcellOK;
+        }
+    }
+
+    LWCELL_MSG_VAR_ALLOC(msg, blocking);
+    LWCELL_MSG_VAR_SET_EVT(msg, evt_fn, evt_arg);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CDNSGIP;
+    LWCELL_MSG_VAR_REF(msg).msg.dns.host = host;
+    LWCELL_MSG_VAR_REF(msg).msg.dns.ip = ip;
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 20000);
+}
+
+/**
+ * \brief           Get IP address from cache without sending any command to device
+ * \param[in]       host: Host name
+ * \param[out]      ip: Pointer to output IP address
+ * \return          `1` if valid entry was found, `0` otherwise
+ */
+uint8_t
+lwcell_dns_cache_get(const char* host, lwcell_ip_t* ip) {
+    uint8_t res;
+
+    LWCELL_ASSERT0(host != NULL);
+    LWCELL_ASSERT0(ip != NULL);
+
+    lwcell_core_lock();
+    res = lwcelli_dns_cache_lookup(host, ip);
+    lwcell_core_unlock();
+    return res;
+}
+
+/**
+ * \brief           Remove all entries from DNS cache
+ */
+void
+lwcell_dns_cache_flush(void) {
+    lwcell_core_lock();
+    LWCELL_MEMSET(dns_cache, 0x00, sizeof(dns_cache));
+    lwcell_core_unlock();
+}
+
+#endif /* LWCELL_CFG_DNS || __DOXYGEN__ */
@@ -170,6 +170,41 @@ lwcell_evt_operator_scan_get_length(lwcell_evt_t* cc) {
     return cc->evt.operator_scan.opf;
 }
 
+/**
+ * \brief           Get operator entry parsed during scan
+ * \param[in]       cc: Event data
+ * \return          Operator entry
+ */
+const lwcell_operator_t*
+lwcell_evt_operator_scan_entry_get_entry(lwcell_evt_t* cc) {
+    return cc->evt.operator_scan_entry.op;
+}
+
+/**
+ * \brief           Get index of operator entry parsed during scan
+ * \param[in]       cc: Event data
+ * \return          Entry index in user array
+ */
+size_t
+lwcell_evt_operator_scan_entry_get_index(lwcell_evt_t* cc) {
+    return cc->evt.operator_scan_entry.idx;
+}
+
+#if LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+
+/**
+ * \brief           Get pipeline statistics
+ * \note            Per command statistics are read with \ref lwcell_pipe_get_cmd_stats
+ * \param[in]       cc: Event data
+ * \return          Pipeline statistics, valid only during event callback
+ */
+const lwcell_pipe_stats_t*
+lwcell_evt_pipe_stats_get_stats(lwcell_evt_t* cc) {
+    return cc->evt.pipe_stats.stats;
+}
+
+#endif /* LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
+
 /**
  * \brief           Get RSSi from CSQ command
  * \param[in]       cc: Event data
@@ -302,6 +337,79 @@ lwcell_evt_conn_poll_get_conn(lwcell_evt_t* cc) {
     return cc->evt.conn_poll.conn;
 }
 
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__
+
+/**
+ * \brief           Get connection handle for writable event
+ * \param[in]       cc: Event handle
+ * \return          Connection handle
+ */
+lwcell_conn_p
+lwcell_evt_conn_writable_get_conn(lwcell_evt_t* cc) {
+    return cc->evt.conn_writable.conn;
+}
+
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH || __DOXYGEN__ */
+
+#if LWCELL_CFG_CONN_STATS || __DOXYGEN__
+
+/**
+ * \brief           Get connection handle for statistics event
+ * \param[in]       cc: Event handle
+ * \return          Connection handle
+ */
+lwcell_conn_p
+lwcell_evt_conn_stats_get_conn(lwcell_evt_t* cc) {
+    return cc->evt.conn_stats.conn;
+}
+
+/**
+ * \brief           Get connection statistics
+ * \note            Statistics are valid only for the time of event callback
+ * \param[in]       cc: Event handle
+ * \return          Pointer to connection statistics
+ */
+const lwcell_conn_stats_t*
+lwcell_evt_conn_stats_get_stats(lwcell_evt_t* cc) {
+    return cc->evt.conn_stats.stats;
+}
+
+#endif /* LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
+
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+
+/**
+ * \brief           Get server command result
+ * \param[in]       cc: Event handle
+ * \return          Member of \ref lwcellr_t enumeration
+ */
+lwcellr_t
+lwcell_evt_server_get_result(lwcell_evt_t* cc) {
+    return cc->evt.server.res;
+}
+
+/**
+ * \brief           Check if server is enabled
+ * \param[in]       cc: Event handle
+ * \return          `1` if enabled, `0` otherwise
+ */
+uint8_t
+lwcell_evt_server_is_enable(lwcell_evt_t* cc) {
+    return cc->evt.server.en;
+}
+
+/**
+ * \brief           Get server port
+ * \param[in]       cc: Event handle
+ * \return          Server port number
+ */
+lwcell_port_t
+lwcell_evt_server_get_port(lwcell_evt_t* cc) {
+    return cc->evt.server.port;
+}
+
+#endif /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
+
 /**
  * \brief           Get connection error type
  * \param[in]       cc: Event handle
@@ -376,6 +484,31 @@ lwcell_evt_sms_recv_get_mem(lwcell_evt_t* cc) {
     return cc->evt.sms_recv.mem;
 }
 
+#if LWCELL_CFG_SMS_DIRECT || __DOXYGEN__
+
+/**
+ * \brief           Get SMS entry received directly with `+CMT`
+ * \param[in]       cc: Event handle
+ * \return          SMS entry, valid only during event callback
+ */
+const lwcell_sms_entry_t*
+lwcell_evt_sms_deliver_get_entry(lwcell_evt_t* cc) {
+    return cc->evt.sms_deliver.entry;
+}
+
+/**
+ * \brief           Get result of queuing `AT+CNMA` acknowledge for message received directly
+ * \param[in]       cc: Event handle
+ * \return          \ref lwcellOK if acknowledge is queued or not used, member of \ref lwcellr_t otherwise.
+ *                  Network may resend message, which acknowledge failed
+ */
+lwcellr_t
+lwcell_evt_sms_deliver_get_ack_result(lwcell_evt_t* cc) {
+    return cc->evt.sms_deliver.ack_res;
+}
+
+#endif /* LWCELL_CFG_SMS_DIRECT || __DOXYGEN__ */
+
 /**
  * \brief           Get SMS entry after successful read
  * \param[in]       cc: Event handle
@@ -417,6 +550,62 @@ lwcell_evt_sms_send_get_pos(lwcell_evt_t* cc) {
     return cc->evt.sms_send.pos;
 }
 
+#if LWCELL_CFG_SMS_BULK || __DOXYGEN__
+
+/**
+ * \brief           Get bulk SMS job handle
+ * \param[in]       cc: Event handle
+ * \return          Bulk SMS job
+ */
+lwcell_sms_bulk_t*
+lwcell_evt_sms_bulk_get_job(lwcell_evt_t* cc) {
+    return cc->evt.sms_bulk.job;
+}
+
+/**
+ * \brief           Get index of processed recipient in bulk SMS job
+ * \note            Valid only when job is not done
+ * \param[in]       cc: Event handle
+ * \return          Recipient index
+ */
+size_t
+lwcell_evt_sms_bulk_get_index(lwcell_evt_t* cc) {
+    return cc->evt.sms_bulk.idx;
+}
+
+/**
+ * \brief           Get send result of processed recipient in bulk SMS job
+ * \param[in]       cc: Event handle
+ * \return          Member of \ref lwcellr_t enumeration
+ */
+lwcellr_t
+lwcell_evt_sms_bulk_get_result(lwcell_evt_t* cc) {
+    return cc->evt.sms_bulk.res;
+}
+
+/**
+ * \brief           Get message reference of processed recipient in bulk SMS job
+ * \note            Use only if SMS sent successfully
+ * \param[in]       cc: Event handle
+ * \return          Message reference
+ */
+size_t
+lwcell_evt_sms_bulk_get_pos(lwcell_evt_t* cc) {
+    return cc->evt.sms_bulk.pos;
+}
+
+/**
+ * \brief           Check if bulk SMS job has finished
+ * \param[in]       cc: Event handle
+ * \return          `1` if job finished, `0` if event reports single recipient
+ */
+uint8_t
+lwcell_evt_sms_bulk_is_done(lwcell_evt_t* cc) {
+    return cc->evt.sms_bulk.done;
+}
+
+#endif /* LWCELL_CFG_SMS_BULK || __DOXYGEN__ */
+
 /**
  * \brief           Get SMS delete result status
  * \param[in]       cc: Event handle
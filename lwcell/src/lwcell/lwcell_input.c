@@ -53,6 +53,11 @@ lwcell_input(const void* data, size_t len) {
         return lwcellERR;
     }
     lwcell_buff_write(&lwcell.buff, data, len);         /* Write data to buffer */
+#if LWCELL_CFG_PIPE_STATS
+    if (lwcell_buff_get_full(&lwcell.buff) > lwcell.pipe.buff_max) {
+        lwcell.pipe.buff_max = lwcell_buff_get_full(&lwcell.buff);
+    }
+#endif                                                  /* LWCELL_CFG_PIPE_STATS */
     lwcell_sys_mbox_putnow(&lwcell.mbox_process, NULL); /* Write empty box, don't care if write fails */
     lwcell_recv_total_len += len;                       /* Update total number of received bytes */
     ++lwcell_recv_calls;                                /* Update number of calls */
@@ -92,3 +97,18 @@ lwcell_input_process(const void* data, size_t len) {
 }
 
 #endif /* LWCELL_CFG_INPUT_USE_PROCESS || __DOXYGEN__ */
+
+#if LWCELL_CFG_PIPE_STATS || __DOXYGEN__
+
+/**
+ * \brief           Get input counters for pipeline statistics
+ * \param[out]      len: Total number of received bytes
+ * \param[out]      calls: Total number of input function calls
+ */
+void
+lwcelli_input_get_stats(uint32_t* len, uint32_t* calls) {
+    *len = lwcell_recv_total_len;
+    *calls = lwcell_recv_calls;
+}
+
+#endif /* LWCELL_CFG_PIPE_STATS || __DOXYGEN__ */
@@ -161,6 +161,35 @@ const size_t lwcell_dev_model_map_size = LWCELL_ARRAYSIZE(lwcell_dev_model_map);
         }                                                                                                              \
     } while (0)
 
+/**
+ * \brief           Get number of bytes sent for send message itself
+ *
+ * When other requests were merged to the message,
+ * only bytes of original request are reported
+ *
+ * \param[in]       m: Send data message type
+ */
+#if LWCELL_CFG_CONN_TX_COALESCE
+#define CONN_SEND_DATA_SENT(m)                                                                                         \
+    ((m)->msg.conn_send.merged ? LWCELL_MIN((m)->msg.conn_send.sent_all, (m)->msg.conn_send.own_len)                   \
+                               : (m)->msg.conn_send.sent_all)
+#else /* LWCELL_CFG_CONN_TX_COALESCE */
+#define CONN_SEND_DATA_SENT(m) ((m)->msg.conn_send.sent_all)
+#endif /* !LWCELL_CFG_CONN_TX_COALESCE */
+
+/**
+ * \brief           Notify application that write buffer memory may be available again
+ *
+ * Memory of finished send is released, any connection blocked on write may continue
+ *
+ * \param[in]       m: Send data message type
+ */
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH
+#define CONN_SEND_DATA_WRITABLE(m) lwcelli_conn_writable_check()
+#else /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH */
+#define CONN_SEND_DATA_WRITABLE(m)
+#endif /* !LWCELL_CFG_CONN_WRITE_AUTO_FLUSH */
+
 /**
  * \brief           Send connection callback for "data send"
  * \param[in]       m: Command message
@@ -172,8 +201,9 @@ const size_t lwcell_dev_model_map_size = LWCELL_ARRAYSIZE(lwcell_dev_model_map);
         lwcell.evt.type = LWCELL_EVT_CONN_SEND;                                                                        \
         lwcell.evt.evt.conn_data_send.res = err;                                                                       \
         lwcell.evt.evt.conn_data_send.conn = (m)->msg.conn_send.conn;                                                  \
-        lwcell.evt.evt.conn_data_send.sent = (m)->msg.conn_send.sent_all;                                              \
+        lwcell.evt.evt.conn_data_send.sent = CONN_SEND_DATA_SENT(m);                                                   \
         lwcelli_send_conn_cb((m)->msg.conn_send.conn, NULL);                                                           \
+        CONN_SEND_DATA_WRITABLE(m);                                                                                    \
     } while (0)
 
 /**
@@ -207,7 +237,7 @@ const size_t lwcell_dev_model_map_size = LWCELL_ARRAYSIZE(lwcell_dev_model_map);
     do {                                                                                                               \
         lwcell.evt.evt.operator_scan.res = err;                                                                        \
         lwcell.evt.evt.operator_scan.ops = (m)->msg.cops_scan.ops;                                                     \
-        lwcell.evt.evt.operator_scan.opf = *(m)->msg.cops_scan.opf;                                                    \
+        lwcell.evt.evt.operator_scan.opf = (m)->msg.cops_scan.opsi;                                                    \
         lwcelli_send_cb(LWCELL_EVT_OPERATOR_SCAN);                                                                     \
     } while (0)
 
@@ -430,6 +460,50 @@ lwcelli_send_sms_stat(lwcell_sms_status_t status, uint8_t q, uint8_t c) {
     lwcelli_send_string(t, 0, q, c);
 }
 
+/**
+ * \brief           Finish SMS list entry after its data line has been received
+ *
+ * For streamed list, entry is reported to user callback and scratch entry is reused,
+ * otherwise next entry in array is used.
+ *
+ * \param[in]       msg: SMS list message
+ */
+static void
+lwcelli_sms_list_entry_done(lwcell_msg_t* msg) {
+    if (msg->msg.sms_list.fn != NULL && !msg->msg.sms_list.fn(msg->msg.sms_list.entries, msg->msg.sms_list.fn_arg)) {
+        msg->msg.sms_list.stop = 1; /* Ignore remaining entries until command finishes */
+    }
+    ++msg->msg.sms_list.ei;             /* Go to next entry */
+    if (msg->msg.sms_list.er != NULL) { /* Check and update user variable */
+        *msg->msg.sms_list.er = msg->msg.sms_list.ei;
+    }
+}
+
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+
+/**
+ * \brief           Send binary data to device in hex format, `2` characters per byte
+ * \param[in]       data: Data to send
+ * \param[in]       len: Length of data in units of bytes
+ */
+static void
+lwcelli_send_hex(const uint8_t* data, size_t len) {
+    static const char hex[] = "0123456789ABCDEF";
+    char str[32];
+    size_t i = 0;
+
+    for (size_t k = 0; k < len; ++k) {
+        str[i++] = hex[data[k] >> 4];
+        str[i++] = hex[data[k] & 0x0F];
+        if (i == sizeof(str) || k == len - 1) {
+            AT_PORT_SEND(str, i);
+            i = 0;
+        }
+    }
+}
+
+#endif /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
+
 #endif /* LWCELL_CFG_SMS */
 
 #if LWCELL_CFG_CONN || __DOXYGEN__
@@ -555,6 +629,146 @@ lwcelli_send_conn_cb(lwcell_conn_t* conn, lwcell_evt_fn evt) {
     return lwcell_conn_close(conn, 0);
 }
 
+#if LWCELL_CFG_CONN_TX_COALESCE || __DOXYGEN__
+
+/**
+ * \brief           Seal send message before first packet is sent to device
+ *
+ * No more requests can be merged to the message after this point.
+ * If there were requests merged, data of original request are copied
+ * to the front of merged buffer, which becomes new data to send
+ *
+ * \param[in]       msg: Send data message
+ */
+static void
+lwcelli_conn_send_coalesce_seal(lwcell_msg_t* msg) {
+    lwcell_conn_t* c = msg->msg.conn_send.conn;
+
+    if (c->tx_leader == msg) {
+        c->tx_leader = NULL;
+    }
+    if (msg->msg.conn_send.merge_buff != NULL && !msg->msg.conn_send.merged) {
+        LWCELL_MEMCPY(msg->msg.conn_send.merge_buff, msg->msg.conn_send.data, msg->msg.conn_send.btw);
+        CONN_SEND_DATA_FREE(msg); /* Original data are not needed anymore */
+
+        msg->msg.conn_send.own_len = msg->msg.conn_send.btw;
+        msg->msg.conn_send.own_bw = msg->msg.conn_send.bw;
+        msg->msg.conn_send.bw = NULL;
+        msg->msg.conn_send.data = msg->msg.conn_send.merge_buff;
+        msg->msg.conn_send.merge_buff = NULL;
+        msg->msg.conn_send.fau = 1; /* Free merged buffer after use */
+        msg->msg.conn_send.btw += msg->msg.conn_send.merge_len;
+        msg->msg.conn_send.merged = 1;
+        LWCELL_DEBUGF(LWCELL_CFG_DBG_CONN | LWCELL_DBG_TYPE_TRACE,
+                      "[LWCELL CONN] Coalesced send of %d bytes on connection %d\r\n", (int)msg->msg.conn_send.btw,
+                      (int)c->num);
+    }
+}
+
+/**
+ * \brief           Finish send requests merged to send message
+ *
+ * Function is called when send message is finished or could not be started.
+ * Every merged request gets its own \ref LWCELL_EVT_CONN_SEND event
+ * with number of its bytes actually sent, blocking callers are released.
+ *
+ * \param[in]       msg: Send data message
+ */
+void
+lwcelli_conn_send_coalesce_finish(lwcell_msg_t* msg) {
+    lwcell_conn_t* c = msg->msg.conn_send.conn;
+    lwcell_msg_t *f, *next;
+    size_t off, sent;
+
+    lwcell_core_lock();
+    if (c->tx_leader == msg) {
+        c->tx_leader = NULL;
+    }
+    lwcell_mem_free_s((void**)&msg->msg.conn_send.merge_buff); /* Set only when message was never sealed */
+    if (msg->msg.conn_send.merged && msg->msg.conn_send.own_bw != NULL) {
+        *msg->msg.conn_send.own_bw = CONN_SEND_DATA_SENT(msg);
+    }
+
+    off = msg->msg.conn_send.own_len;
+    for (f = msg->msg.conn_send.next; f != NULL; f = next) {
+        next = f->msg.conn_send.next;
+
+        /* Get part of merged data that belongs to this request */
+        sent = 0;
+        if (msg->msg.conn_send.merged && msg->msg.conn_send.sent_all > off) {
+            sent = LWCELL_MIN(msg->msg.conn_send.sent_all - off, f->msg.conn_send.btw);
+        }
+        off += f->msg.conn_send.btw;
+        f->res = sent == f->msg.conn_send.btw ? lwcellOK : (msg->res != lwcellOK ? msg->res : lwcellERR);
+        if (f->msg.conn_send.bw != NULL) {
+            *f->msg.conn_send.bw = sent;
+        }
+
+        lwcell.evt.type = LWCELL_EVT_CONN_SEND;
+        lwcell.evt.evt.conn_data_send.res = f->res;
+        lwcell.evt.evt.conn_data_send.conn = c;
+        lwcell.evt.evt.conn_data_send.sent = sent;
+        lwcelli_send_conn_cb(c, NULL);
+
+        if (f->is_blocking) {
+            lwcell_sys_sem_release(&f->sem);
+        } else {
+            LWCELL_MSG_VAR_FREE(f);
+        }
+    }
+    msg->msg.conn_send.next = NULL;
+    lwcell_core_unlock();
+}
+
+#endif /* LWCELL_CFG_CONN_TX_COALESCE || __DOXYGEN__ */
+
+#if LWCELL_CFG_CONN_STATS || __DOXYGEN__
+
+/**
+ * \brief           Update connection statistics after `SEND OK` or `SEND FAIL` response
+ * \param[in]       sent: Status whether last packet was sent or not
+ */
+static void
+lwcelli_conn_stats_send(uint8_t sent) {
+    lwcell_conn_stats_t* s = &lwcell.msg->msg.conn_send.conn->stats;
+    uint32_t latency;
+    uint8_t bin;
+
+    if (sent) {
+        latency = lwcell_sys_now() - lwcell.msg->msg.conn_send.data_time;
+        s->tx_bytes += lwcell.msg->msg.conn_send.sent;
+        ++s->tx_chunks;
+        s->send_ok_latency_sum += latency;
+        s->send_ok_latency_max = LWCELL_MAX(s->send_ok_latency_max, latency);
+        for (bin = 0; bin < LWCELL_CONN_STATS_LATENCY_BINS - 1 && latency >= (50UL << bin); ++bin) {}
+        ++s->send_ok_latency_hist[bin];
+    } else {
+        ++s->tx_fails;
+        if ((lwcell.msg->msg.conn_send.tries + 1) < LWCELL_CFG_MAX_SEND_RETRIES) {
+            ++s->tx_retries; /* Same data will be sent again */
+        }
+    }
+}
+
+/**
+ * \brief           Update connection statistics for data sent to application
+ * \param[in]       conn: Connection handle
+ * \param[in]       len: Number of bytes in packet buffer
+ */
+static void
+lwcelli_conn_stats_recv(lwcell_conn_p conn, size_t len) {
+    lwcell_conn_stats_t* s = &conn->stats;
+
+    s->rx_bytes += len;
+    if (!s->rx_chunks || len < s->rx_chunk_min) {
+        s->rx_chunk_min = len;
+    }
+    s->rx_chunk_max = LWCELL_MAX(s->rx_chunk_max, len);
+    ++s->rx_chunks;
+}
+
+#endif /* LWCELL_CFG_CONN_STATS || __DOXYGEN__ */
+
 /**
  * \brief           Process and send data from device buffer
  * \return          Member of \ref lwcellr_t enumeration
@@ -569,7 +783,17 @@ lwcelli_tcpip_process_send_data(void) {
         CONN_SEND_DATA_SEND_EVT(lwcell.msg, lwcellCLOSED);
         return lwcellERR;
     }
+#if LWCELL_CFG_CONN_TX_COALESCE
+    lwcelli_conn_send_coalesce_seal(lwcell.msg);
+#endif /* LWCELL_CFG_CONN_TX_COALESCE */
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND
+    lwcell.msg->msg.conn_send.sent = LWCELL_MIN(lwcell.msg->msg.conn_send.btw, c->send_chunk);
+#else  /* LWCELL_CFG_CONN_ADAPTIVE_SEND */
     lwcell.msg->msg.conn_send.sent = LWCELL_MIN(lwcell.msg->msg.conn_send.btw, LWCELL_CFG_CONN_MAX_DATA_LEN);
+#endif /* !LWCELL_CFG_CONN_ADAPTIVE_SEND */
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND || LWCELL_CFG_CONN_STATS
+    lwcell.msg->msg.conn_send.send_time = lwcell_sys_now();
+#endif /* LWCELL_CFG_CONN_ADAPTIVE_SEND || LWCELL_CFG_CONN_STATS */
 
     AT_PORT_SEND_BEGIN_AT();
     AT_PORT_SEND_CONST_STR("+CIPSEND=");
@@ -587,6 +811,178 @@ lwcelli_tcpip_process_send_data(void) {
     return lwcellOK;
 }
 
+#if LWCELL_CFG_CONN_TRANSPARENT || __DOXYGEN__
+
+/**
+ * \brief           Send data directly to AT port when device is in transparent data mode
+ *
+ * There is no response from device in data mode,
+ * command is finished immediately after data are written to low-level
+ *
+ * \return          Member of \ref lwcellr_t enumeration
+ */
+static lwcellr_t
+lwcelli_tcpip_process_send_data_transparent(void) {
+    lwcell_conn_t* c = lwcell.msg->msg.conn_send.conn;
+    if (!lwcell_conn_is_active(c) ||                  /* Is the connection already closed? */
+        lwcell.msg->msg.conn_send.val_id != c->val_id /* Did validation ID change after we set parameter? */
+    ) {
+        CONN_SEND_DATA_SEND_EVT(lwcell.msg, lwcellCLOSED);
+        return lwcellERR;
+    }
+    if (!lwcell.m.data_mode) { /* Data cannot be sent in command mode */
+        CONN_SEND_DATA_SEND_EVT(lwcell.msg, lwcellERR);
+        return lwcellERR;
+    }
+
+    /* Stream data to device as-is */
+    AT_PORT_SEND_WITH_FLUSH(lwcell.msg->msg.conn_send.data, lwcell.msg->msg.conn_send.btw);
+    lwcell.msg->msg.conn_send.sent = lwcell.msg->msg.conn_send.btw;
+    lwcell.msg->msg.conn_send.sent_all = lwcell.msg->msg.conn_send.btw;
+    lwcell.msg->msg.conn_send.btw = 0;
+    if (lwcell.msg->msg.conn_send.bw != NULL) {
+        *lwcell.msg->msg.conn_send.bw = lwcell.msg->msg.conn_send.sent_all;
+    }
+    CONN_SEND_DATA_SEND_EVT(lwcell.msg, lwcellOK);
+
+    lwcell_sys_sem_release(&lwcell.sem_sync); /* Command finished, release producer thread */
+    return lwcellOK;
+}
+
+static const char transparent_close_seq[] = CRLF "CLOSED" CRLF; /*!< Remote close sequence in data mode */
+
+/**
+ * \brief           Send data received in transparent data mode to connection callback
+ * \param[in]       conn: Connection handle
+ * \param[in]       data: Pointer to received data
+ * \param[in]       len: Number of bytes to send to application
+ */
+static void
+lwcelli_transparent_recv(lwcell_conn_t* conn, const uint8_t* data, size_t len) {
+    size_t off, new_len;
+
+    /* Send data to application in packet buffers */
+    for (off = 0; off < len && conn->status.f.active && !conn->status.f.in_closing; off += new_len) {
+        lwcell_pbuf_p pbuf;
+
+        new_len = LWCELL_MIN(len - off, LWCELL_CFG_CONN_MAX_DATA_LEN);
+        do {
+            pbuf = lwcell_pbuf_new(new_len); /* Allocate new packet buffer */
+        } while (pbuf == NULL && (new_len = (new_len >> 1)) >= LWCELL_CFG_CONN_MIN_DATA_LEN);
+        if (pbuf == NULL) {
+            LWCELL_DEBUGF(LWCELL_CFG_DBG_IPD | LWCELL_DBG_TYPE_TRACE | LWCELL_DBG_LVL_WARNING,
+                          "[LWCELL IPD] Buffer allocation failed, skipping %d byte(s)\r\n", (int)(len - off));
+#if LWCELL_CFG_CONN_STATS
+            ++conn->stats.rx_alloc_fails;
+#endif /* LWCELL_CFG_CONN_STATS */
+            break;
+        }
+        LWCELL_MEMCPY(pbuf->payload, &data[off], new_len);
+        conn->total_recved += new_len;
+#if LWCELL_CFG_CONN_STATS
+        lwcelli_conn_stats_recv(conn, new_len);
+#endif /* LWCELL_CFG_CONN_STATS */
+        conn->status.f.data_received = 1;
+
+        lwcell.evt.type = LWCELL_EVT_CONN_RECV;
+        lwcell.evt.evt.conn_data_recv.buff = pbuf;
+        lwcell.evt.evt.conn_data_recv.conn = conn;
+        if (lwcelli_send_conn_cb(conn, NULL) == lwcellOKIGNOREMORE) {
+            new_len = len - off; /* Ignore the rest of received data */
+        }
+        lwcell_pbuf_free(pbuf);
+    }
+}
+
+/**
+ * \brief           Process received data when device is in transparent data mode
+ *
+ * Data are written to packet buffers and sent to connection callback.
+ * Bytes matching start of remote close sequence are held back until sequence is complete or broken,
+ * complete sequence is removed from data.
+ * Function stops processing after remote close sequence, as device returns to command mode
+ *
+ * \param[in]       data: Pointer to received data
+ * \param[in]       len: Number of bytes available in data array
+ * \return          Number of bytes processed as connection data
+ */
+static size_t
+lwcelli_process_transparent_data(const uint8_t* data, size_t len) {
+    const char* close_seq = transparent_close_seq;
+    lwcell_conn_t* conn = &lwcell.m.conns[0];
+    size_t processed, ptr, held, start = 0;
+    uint8_t closed = 0;
+
+    ptr = held = lwcell.m.data_mode_close_ptr; /* Bytes held back from previous call */
+    for (processed = 0; processed < len && !closed;) {
+        uint8_t ch = data[processed++];
+        if (ch == (uint8_t)close_seq[ptr]) {
+            if (ptr == 0) {
+                start = processed - 1; /* Possible start of close sequence */
+            }
+            if (++ptr == (sizeof(transparent_close_seq) - 1)) {
+                closed = 1;
+            }
+        } else {
+            /* Sequence broken, held back bytes are data */
+            if (held > 0) {
+                lwcelli_transparent_recv(conn, (const uint8_t*)close_seq, held);
+                held = 0;
+            }
+            ptr = 0;
+            if (ch == '\r') {
+                ptr = 1;
+                start = processed - 1;
+            }
+        }
+    }
+
+    /* Send data up to start of (possible) close sequence */
+    lwcelli_transparent_recv(conn, data, ptr > 0 ? start : processed);
+
+    /* Device is back in command mode after connection has been closed */
+    if (closed) {
+        lwcell.m.data_mode = 0;
+        lwcell.m.data_mode_close_ptr = 0;
+        if (conn->status.f.active) {
+            lwcelli_conn_closed_process(0, 0);
+        }
+    } else {
+        lwcell.m.data_mode_close_ptr = (uint8_t)ptr;
+    }
+    return processed;
+}
+
+#endif /* LWCELL_CFG_CONN_TRANSPARENT || __DOXYGEN__ */
+
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND || __DOXYGEN__
+
+/**
+ * \brief           Adapt send chunk size of connection to link conditions
+ *
+ * Chunk size is halved on failed send and decreased by quarter on slow send.
+ * Fast send of full chunk increases it by quarter, up to maximum reported by device
+ *
+ * \param[in]       sent: Status whether last packet was sent or not
+ */
+static void
+lwcelli_tcpip_adapt_send_chunk(uint8_t sent) {
+    lwcell_conn_t* c = lwcell.msg->msg.conn_send.conn;
+    size_t chunk = c->send_chunk;
+
+    if (!sent) {
+        chunk /= 2;
+    } else if ((uint32_t)(lwcell_sys_now() - lwcell.msg->msg.conn_send.send_time)
+               > LWCELL_CFG_CONN_ADAPTIVE_SEND_LATENCY) {
+        chunk -= chunk / 4;
+    } else if (lwcell.msg->msg.conn_send.sent == chunk) {
+        chunk += chunk / 4;
+    }
+    c->send_chunk = LWCELL_MIN(LWCELL_MAX(chunk, LWCELL_CFG_CONN_ADAPTIVE_SEND_MIN_LEN), c->send_max);
+}
+
+#endif /* LWCELL_CFG_CONN_ADAPTIVE_SEND || __DOXYGEN__ */
+
 /**
  * \brief           Process data sent and send remaining
  * \param[in]       sent: Status whether data were sent or not,
@@ -595,6 +991,12 @@ lwcelli_tcpip_process_send_data(void) {
  */
 static uint8_t
 lwcelli_tcpip_process_data_sent(uint8_t sent) {
+#if LWCELL_CFG_CONN_STATS
+    lwcelli_conn_stats_send(sent);
+#endif /* LWCELL_CFG_CONN_STATS */
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND
+    lwcelli_tcpip_adapt_send_chunk(sent);
+#endif /* LWCELL_CFG_CONN_ADAPTIVE_SEND */
     if (sent) { /* Data were successfully sent */
         lwcell.msg->msg.conn_send.sent_all += lwcell.msg->msg.conn_send.sent;
         lwcell.msg->msg.conn_send.btw -= lwcell.msg->msg.conn_send.sent;
@@ -670,6 +1072,140 @@ lwcelli_send_conn_error_cb(lwcell_msg_t* msg, lwcellr_t error) {
     LWCELL_UNUSED(msg);
 }
 
+/**
+ * \brief           Reset connection structure and set it to active state
+ * \param[in]       num: Connection number
+ * \return          Connection handle
+ */
+static lwcell_conn_t*
+lwcelli_conn_reset_active(uint8_t num) {
+    lwcell_conn_t* conn = &lwcell.m.conns[num]; /* Get connection handle */
+    uint8_t id;
+
+    id = conn->val_id;
+    LWCELL_MEMSET(conn, 0x00, sizeof(*conn)); /* Reset connection parameters */
+    conn->num = num;
+    conn->status.f.active = 1;
+    conn->val_id = ++id; /* Set new validation ID */
+#if LWCELL_CFG_CONN_WRITE_AUTO_FLUSH
+    conn->write_flush_time = LWCELL_CFG_CONN_WRITE_AUTO_FLUSH_TIME;
+    conn->write_flush_size = LWCELL_CFG_CONN_WRITE_AUTO_FLUSH_SIZE;
+#endif /* LWCELL_CFG_CONN_WRITE_AUTO_FLUSH */
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND
+    conn->send_max = LWCELL_CFG_CONN_MAX_DATA_LEN; /* Used until device reports its maximum */
+    conn->send_chunk = LWCELL_CFG_CONN_MAX_DATA_LEN;
+#endif /* LWCELL_CFG_CONN_ADAPTIVE_SEND */
+    return conn;
+}
+
+/**
+ * \brief           Set connection to active state after successful connect response
+ * \param[in]       num: Connection number
+ */
+static void
+lwcelli_conn_set_active(uint8_t num) {
+    lwcell_conn_t* conn = lwcelli_conn_reset_active(num);
+
+    /* Set connection parameters */
+    conn->status.f.client = 1;
+    conn->evt_func = lwcell.msg->msg.conn_start.evt_func;
+    conn->arg = lwcell.msg->msg.conn_start.arg;
+}
+
+#if LWCELL_CFG_CONN_SERVER || __DOXYGEN__
+
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND || __DOXYGEN__
+
+/**
+ * \brief           Queue query of maximal data length for connection accepted by server
+ * \param[in]       num: Connection number
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+static lwcellr_t
+lwcelli_conn_send_max_query(uint8_t num) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    LWCELL_MSG_VAR_ALLOC(msg, 0);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CIPSEND_GET;
+    LWCELL_MSG_VAR_REF(msg).msg.conn_send_max.num = num;
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 10000);
+}
+
+#endif /* LWCELL_CFG_CONN_ADAPTIVE_SEND || __DOXYGEN__ */
+
+/**
+ * \brief           Process new incoming connection accepted by server
+ * \param[in]       num: Connection number
+ * \param[in]       str: Pointer to remote IP address string
+ */
+static void
+lwcelli_conn_server_accept(uint8_t num, const char* str) {
+    lwcell_conn_t* conn = lwcelli_conn_reset_active(num);
+
+    conn->evt_func = lwcell.m.server_evt_func;
+    conn->local_port = lwcell.m.server_port;
+    lwcelli_parse_ip(&str, &conn->remote_ip);
+
+    lwcell.evt.type = LWCELL_EVT_CONN_ACTIVE; /* Connection just active */
+    lwcell.evt.evt.conn_active_close.client = 0;
+    lwcell.evt.evt.conn_active_close.conn = conn;
+    lwcell.evt.evt.conn_active_close.forced = 0;
+    lwcelli_send_conn_cb(conn, NULL);
+    lwcelli_conn_start_timeout(conn); /* Start connection timeout timer */
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND
+    lwcelli_conn_send_max_query(num); /* Default length is used until device reports its maximum */
+#endif /* LWCELL_CFG_CONN_ADAPTIVE_SEND */
+}
+
+/**
+ * \brief           Send server status event to application
+ * \param[in]       en: Server enabled status
+ * \param[in]       port: Server port
+ * \param[in]       res: Result of server command
+ */
+static void
+lwcelli_send_server_evt(uint8_t en, lwcell_port_t port, lwcellr_t res) {
+    lwcell.evt.evt.server.en = en;
+    lwcell.evt.evt.server.port = port;
+    lwcell.evt.evt.server.res = res;
+    lwcelli_send_cb(LWCELL_EVT_SERVER);
+}
+
+#endif /* LWCELL_CFG_CONN_SERVER || __DOXYGEN__ */
+
+/**
+ * \brief           Finish connection start sequence and notify application
+ * \param[in]       msg: Message from user with connection start
+ * \param[in,out]   stat: Status flags
+ */
+static void
+lwcelli_conn_start_finish(lwcell_msg_t* msg, lwcell_status_flags_t* stat) {
+    switch (msg->msg.conn_start.conn_res) {
+        case LWCELL_CONN_CONNECT_OK: {                                      /* Successfully connected */
+            lwcell_conn_t* conn = &lwcell.m.conns[msg->msg.conn_start.num]; /* Get connection number */
+
+            lwcell.evt.type = LWCELL_EVT_CONN_ACTIVE;                       /* Connection just active */
+            lwcell.evt.evt.conn_active_close.client = 1;
+            lwcell.evt.evt.conn_active_close.conn = conn;
+            lwcell.evt.evt.conn_active_close.forced = 1;
+            lwcelli_send_conn_cb(conn, NULL);
+            lwcelli_conn_start_timeout(conn); /* Start connection timeout timer */
+            break;
+        }
+        case LWCELL_CONN_CONNECT_ERROR: { /* Connection error */
+            lwcelli_send_conn_error_cb(msg, lwcellERRCONNFAIL);
+            stat->is_error = 1;           /* Manually set error */
+            stat->is_ok = 0;              /* Reset success */
+            break;
+        }
+        default: {
+            /* Do nothing as of now */
+            break;
+        }
+    }
+}
+
 /**
  * \brief           Checks if connection pointer has valid address
  * \param[in]       conn: Address to check if valid connection ptr
@@ -718,6 +1254,25 @@ lwcelli_conn_closed_process(uint8_t conn_num, uint8_t forced) {
 
 #endif /* LWCELL_CFG_CONN || __DOXYGEN__ */
 
+#if LWCELL_CFG_DNS || __DOXYGEN__
+
+/**
+ * \brief           Get host name to resolve with `AT+CDNSGIP` command
+ * \param[in]       msg: Message with resolve command
+ * \return          Host name
+ */
+static const char*
+lwcelli_dns_get_host(lwcell_msg_t* msg) {
+#if LWCELL_CFG_CONN
+    if (msg->cmd_def == LWCELL_CMD_CIPSTART) {
+        return msg->msg.conn_start.host; /* Host is resolved as part of connection start */
+    }
+#endif /* LWCELL_CFG_CONN */
+    return msg->msg.dns.host;
+}
+
+#endif /* LWCELL_CFG_DNS || __DOXYGEN__ */
+
 /**
  * \brief           Process received string from GSM
  * \param[in]       rcv: Pointer to \ref lwcell_recv_t structure with input string
@@ -761,8 +1316,33 @@ lwcelli_parse_received(lwcell_recv_t* rcv) {
 #endif                                                  /* LWCELL_CFG_NETWORK */
 #if LWCELL_CFG_CONN
         } else if (!strncmp(rcv->data, "+RECEIVE", 8)) {
-            lwcelli_parse_ipd(rcv->data);                                              /* Parse IPD */
+            lwcelli_parse_ipd(rcv->data); /* Parse IPD */
+#if LWCELL_CFG_CONN_MANUAL_RX
+        } else if (!strncmp(rcv->data, "+CIPRXGET", 9)) {
+            lwcelli_parse_ciprxget(rcv->data); /* Parse data notification or read response */
+#endif                                         /* LWCELL_CFG_CONN_MANUAL_RX */
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND
+        } else if (CMD_IS_CUR(LWCELL_CMD_CIPSEND_GET) && !strncmp(rcv->data, "+CIPSEND", 8)) {
+            /* Parse maximal data length for connection */
+            lwcelli_parse_cipsend_max(rcv->data, CMD_IS_DEF(LWCELL_CMD_CIPSTART)
+                                                     ? lwcell.msg->msg.conn_start.num
+                                                     : lwcell.msg->msg.conn_send_max.num);
+#endif                                            /* LWCELL_CFG_CONN_ADAPTIVE_SEND */
 #endif                                                                                 /* LWCELL_CFG_CONN */
+#if LWCELL_CFG_DNS
+        } else if (CMD_IS_CUR(LWCELL_CMD_CDNSGIP) && !strncmp(rcv->data, "+CDNSGIP", 8)) {
+            lwcell_ip_t ip;
+
+            if (lwcelli_parse_cdnsgip(rcv->data, &ip)) {
+                lwcelli_dns_cache_update(lwcelli_dns_get_host(lwcell.msg), &ip);
+                if (CMD_IS_DEF(LWCELL_CMD_CDNSGIP) && lwcell.msg->msg.dns.ip != NULL) {
+                    LWCELL_MEMCPY(lwcell.msg->msg.dns.ip, &ip, sizeof(ip));
+                }
+                stat.is_ok = 1;
+            } else {
+                stat.is_error = 1;
+            }
+#endif /* LWCELL_CFG_DNS */
         } else if (!strncmp(rcv->data, "+CREG", 5)) {                                  /* Check for +CREG indication */
             lwcelli_parse_creg(rcv->data, LWCELL_U8(CMD_IS_CUR(LWCELL_CMD_CREG_GET))); /* Parse +CREG response */
         } else if (!strncmp(rcv->data, "+CPIN", 5)) { /* Check for +CPIN indication for SIM */
@@ -772,6 +1352,14 @@ lwcelli_parse_received(lwcell_recv_t* rcv) {
 #if LWCELL_CFG_SMS
         } else if (CMD_IS_CUR(LWCELL_CMD_CMGS) && !strncmp(rcv->data, "+CMGS", 5)) {
             lwcelli_parse_cmgs(rcv->data, &lwcell.msg->msg.sms_send.pos); /* Parse +CMGS response */
+#if LWCELL_CFG_SMS_BULK
+        } else if (CMD_IS_CUR(LWCELL_CMD_CMGS) && !strncmp(rcv->data, "+CMS ERROR", 10)) {
+            const char* tmp = &rcv->data[10];
+            while (*tmp == ':' || *tmp == ' ') { /* Skip colon and spaces before error code */
+                ++tmp;
+            }
+            lwcell.msg->msg.sms_send.cms_err = (uint16_t)lwcelli_parse_number(&tmp); /* Keep error for retry */
+#endif /* LWCELL_CFG_SMS_BULK */
         } else if (CMD_IS_CUR(LWCELL_CMD_CMGR) && !strncmp(rcv->data, "+CMGR", 5)) {
             if (lwcelli_parse_cmgr(rcv->data)) {                          /* Parse +CMGR response */
                 lwcell.msg->msg.sms_read.read = 2;                        /* Set read flag and process the data */
@@ -786,6 +1374,10 @@ lwcelli_parse_received(lwcell_recv_t* rcv) {
             }
         } else if (!strncmp(rcv->data, "+CMTI", 5)) {
             lwcelli_parse_cmti(rcv->data, 1); /* Parse +CMTI response with received SMS */
+#if LWCELL_CFG_SMS_DIRECT
+        } else if (!strncmp(rcv->data, "+CMT:", 5)) {
+            lwcelli_parse_cmt(rcv->data); /* Parse +CMT header, body follows in next line */
+#endif /* LWCELL_CFG_SMS_DIRECT */
         } else if (CMD_IS_CUR(LWCELL_CMD_CPMS_GET_OPT) && !strncmp(rcv->data, "+CPMS", 5)) {
             lwcelli_parse_cpms(rcv->data, 0); /* Parse +CPMS with SMS memories info */
         } else if (CMD_IS_CUR(LWCELL_CMD_CPMS_GET) && !strncmp(rcv->data, "+CPMS", 5)) {
@@ -837,6 +1429,33 @@ lwcelli_parse_received(lwcell_recv_t* rcv) {
                 lwcelli_process_cipsend_response(rcv, &stat);
             }
             lwcelli_conn_closed_process(num, forced); /* Connection closed, process */
+#if LWCELL_CFG_CONN_SERVER
+        } else if (LWCELL_CHARISNUM(rcv->data[0]) && rcv->data[1] == ',' && rcv->data[2] == ' '
+                   && !strncmp(&rcv->data[3], "REMOTE IP: ", 11)) {
+            uint8_t num = LWCELL_CHARTONUM(rcv->data[0]);
+            if (num < LWCELL_CFG_MAX_CONNS) {
+                lwcelli_conn_server_accept(num, &rcv->data[14]); /* New incoming connection */
+            }
+        } else if (!CMD_IS_CUR(LWCELL_CMD_CIPSERVER) && !strcmp(rcv->data, "SERVER CLOSE" CRLF)) {
+            /* Server closed by device, for example when PDP context is deactivated */
+            if (lwcell.m.server_active) {
+                lwcell.m.server_active = 0;
+                lwcelli_send_server_evt(0, lwcell.m.server_port, lwcellOK);
+            }
+#endif /* LWCELL_CFG_CONN_SERVER */
+#if LWCELL_CFG_CONN_TRANSPARENT
+        } else if (!strcmp(rcv->data, "CLOSE OK" CRLF) || !strcmp(rcv->data, "CLOSED" CRLF)) {
+            uint8_t forced = 0;
+
+            /* Single connection mode reports close status without connection number */
+            if (CMD_IS_CUR(LWCELL_CMD_CIPCLOSE)) {
+                forced = 1;
+                stat.is_ok = 1; /* If forced and connection is closed, command is OK */
+            }
+            if (lwcell.m.conns[0].status.f.active) {
+                lwcelli_conn_closed_process(0, forced); /* Connection closed, process */
+            }
+#endif                                                /* LWCELL_CFG_CONN_TRANSPARENT */
 #endif                                                /* LWCELL_CFG_CONN */
 #if LWCELL_CFG_CALL
         } else if (rcv->data[0] == 'C' && !strncmp(rcv->data, "Call Ready" CRLF, 10 + CRLF_LEN)) {
@@ -852,8 +1471,21 @@ lwcelli_parse_received(lwcell_recv_t* rcv) {
 #if LWCELL_CFG_SMS
         } else if (rcv->data[0] == 'S' && !strncmp(rcv->data, "SMS Ready" CRLF, 9 + CRLF_LEN)) {
             lwcell.m.sms.ready = 1;                /* SMS ready flag */
+#if LWCELL_CFG_MODEM_SHADOW
+            lwcell.m.shadow.sms_format_valid = 0; /* SMS subsystem restarted, settings are back to default */
+            lwcell.m.shadow.sms_mem_valid = 0;
+#endif                                             /* LWCELL_CFG_MODEM_SHADOW */
+#if LWCELL_CFG_SMS_DIRECT
+            lwcell.m.sms.direct = 0; /* New messages are stored by default */
+            lwcell.m.sms.direct_ack = 0;
+#endif /* LWCELL_CFG_SMS_DIRECT */
             lwcelli_send_cb(LWCELL_EVT_SMS_READY); /* Send SMS ready event */
 #endif                                             /* LWCELL_CFG_SMS */
+#if LWCELL_CFG_MODEM_SHADOW
+        } else if (rcv->data[0] == 'R' && !strncmp(rcv->data, "RDY" CRLF, 3 + CRLF_LEN)) {
+            /* Device has (re)booted, all modem-side settings are back to default */
+            LWCELL_MEMSET(&lwcell.m.shadow, 0x00, sizeof(lwcell.m.shadow));
+#endif /* LWCELL_CFG_MODEM_SHADOW */
         } else if ((CMD_IS_CUR(LWCELL_CMD_CGMI_GET) || CMD_IS_CUR(LWCELL_CMD_CGMM_GET)
                     || CMD_IS_CUR(LWCELL_CMD_CGSN_GET) || CMD_IS_CUR(LWCELL_CMD_CGMR_GET))
                    && !stat.is_ok && !stat.is_error && strncmp(rcv->data, "AT+", 3)) {
@@ -941,6 +1573,9 @@ lwcelli_parse_received(lwcell_recv_t* rcv) {
                 } else if (!strncmp(rcv->data, "STATE:", 6)) {
                     processed = 1;
                     lwcelli_parse_cipstatus_conn(rcv->data, 0, &continueScan);
+#if LWCELL_CFG_CONN_TRANSPARENT
+                    continueScan = 0; /* Single connection mode has no connection lines */
+#endif                                /* LWCELL_CFG_CONN_TRANSPARENT */
                 }
 
                 /* Check if we shall stop processing at this stage */
@@ -955,23 +1590,27 @@ lwcelli_parse_received(lwcell_recv_t* rcv) {
             }
 
             /* Wait here for CONNECT status before we cancel connection */
+#if LWCELL_CFG_CONN_TRANSPARENT
+            /* Single connection mode reports status without connection number */
+            if (!strcmp(rcv->data, "CONNECT" CRLF)) {
+                lwcelli_conn_set_active(0);
+                lwcell.m.data_mode = 1; /* Device is now in data mode */
+                lwcell.m.data_mode_close_ptr = 0;
+                lwcell.msg->msg.conn_start.conn_res = LWCELL_CONN_CONNECT_OK;
+                stat.is_ok = 1;
+            } else if (!strcmp(rcv->data, "CONNECT FAIL" CRLF)) {
+                lwcell.msg->msg.conn_start.conn_res = LWCELL_CONN_CONNECT_ERROR;
+                stat.is_error = 1;
+            } else if (!strcmp(rcv->data, "ALREADY CONNECT" CRLF)) {
+                lwcell.msg->msg.conn_start.conn_res = LWCELL_CONN_CONNECT_ALREADY;
+                stat.is_error = 1;
+            }
+#else  /* LWCELL_CFG_CONN_TRANSPARENT */
             if (LWCELL_CHARISNUM(rcv->data[0]) && rcv->data[1] == ',' && rcv->data[2] == ' ') {
                 uint8_t num = LWCELL_CHARTONUM(rcv->data[0]);
                 if (num < LWCELL_CFG_MAX_CONNS) {
-                    uint8_t id;
-                    lwcell_conn_t* conn = &lwcell.m.conns[num]; /* Get connection handle */
-
                     if (!strncmp(&rcv->data[3], "CONNECT OK" CRLF, 10 + CRLF_LEN)) {
-                        id = conn->val_id;
-                        LWCELL_MEMSET(conn, 0x00, sizeof(*conn)); /* Reset connection parameters */
-                        conn->num = num;
-                        conn->status.f.active = 1;
-                        conn->val_id = ++id; /* Set new validation ID */
-
-                        /* Set connection parameters */
-                        conn->status.f.client = 1;
-                        conn->evt_func = lwcell.msg->msg.conn_start.evt_func;
-                        conn->arg = lwcell.msg->msg.conn_start.arg;
+                        lwcelli_conn_set_active(num);
 
                         /* Set status */
                         lwcell.msg->msg.conn_start.conn_res = LWCELL_CONN_CONNECT_OK;
@@ -985,12 +1624,51 @@ lwcelli_parse_received(lwcell_recv_t* rcv) {
                     }
                 }
             }
+#endif /* !LWCELL_CFG_CONN_TRANSPARENT */
         } else if (CMD_IS_CUR(LWCELL_CMD_CIPSEND)) {
             if (stat.is_ok) {
                 stat.is_ok = 0;
             }
             lwcelli_process_cipsend_response(rcv, &stat);
+#if LWCELL_CFG_CONN_SERVER
+        } else if (CMD_IS_CUR(LWCELL_CMD_CIPSERVER)) {
+            /* For CIPSERVER, OK is returned before server status */
+            if (stat.is_ok) {
+                stat.is_ok = 0;
+            }
+            if (!strcmp(rcv->data, "SERVER OK" CRLF)) {
+                lwcell.m.server_active = 1;
+                lwcell.m.server_port = lwcell.msg->msg.tcpip_server.port;
+                lwcell.m.server_evt_func = lwcell.msg->msg.tcpip_server.evt_func;
+                stat.is_ok = 1;
+            } else if (!strcmp(rcv->data, "SERVER CLOSE" CRLF)) {
+                lwcell.m.server_active = 0;
+                stat.is_ok = 1;
+            }
+            if (stat.is_ok || stat.is_error) {
+                lwcelli_send_server_evt(lwcell.m.server_active, lwcell.msg->msg.tcpip_server.port,
+                                        stat.is_ok ? lwcellOK : lwcellERR);
+            }
+#endif /* LWCELL_CFG_CONN_SERVER */
+#if LWCELL_CFG_CONN_TRANSPARENT
+        } else if (CMD_IS_CUR(LWCELL_CMD_ATO)) {
+            /* Device returns to data mode with CONNECT response */
+            if (!strcmp(rcv->data, "CONNECT" CRLF)) {
+                lwcell.m.data_mode = 1;
+                lwcell.m.data_mode_close_ptr = 0;
+                stat.is_ok = 1;
+            } else if (!strcmp(rcv->data, "NO CARRIER" CRLF)) {
+                stat.is_error = 1;
+            }
+#endif /* LWCELL_CFG_CONN_TRANSPARENT */
 #endif /* LWCELL_CFG_CONN */
+#if LWCELL_CFG_DNS
+        } else if (CMD_IS_CUR(LWCELL_CMD_CDNSGIP)) {
+            /* OK is returned before +CDNSGIP with resolved address */
+            if (stat.is_ok && !strcmp(rcv->data, "OK" CRLF)) {
+                stat.is_ok = 0;
+            }
+#endif /* LWCELL_CFG_DNS */
 #if LWCELL_CFG_USSD
         } else if (CMD_IS_CUR(LWCELL_CMD_CUSD)) {
             /* OK is returned before +CUSD */
@@ -1093,12 +1771,31 @@ lwcelli_process(const void* data, size_t data_len) {
         return lwcellERRNODEVICE;
     }
 
+#if LWCELL_CFG_PIPE_STATS
+    /* First data after command started, may also be URC sent by device at the same time */
+    if (lwcell.pipe_wait_byte && lwcell.msg != NULL && data_len > 0) {
+        lwcelli_pipe_hist_add(&lwcell.pipe_cmd[lwcell.msg->cmd_def].first_byte,
+                              lwcell_sys_now() - lwcell.pipe_fn_time);
+        lwcell.pipe_wait_byte = 0;
+    }
+#endif /* LWCELL_CFG_PIPE_STATS */
+
     while (d_len > 0) { /* Read entire set of characters from buffer */
         ch = *d;        /* Get next character */
         ++d;            /* Go to next character, must be here as it is used later on */
         --d_len;        /* Decrease remaining length, must be here as it is decreased later too */
 
         if (0) {
+#if LWCELL_CFG_CONN_TRANSPARENT
+        } else if (lwcell.m.data_mode) { /* Raw data in transparent mode */
+            size_t len;
+
+            /* Process current and as many next characters as possible */
+            len = lwcelli_process_transparent_data(d - 1, d_len + 1);
+            d += len - 1;
+            d_len -= len - 1;
+            ch = d[-1];
+#endif /* LWCELL_CFG_CONN_TRANSPARENT */
 #if LWCELL_CFG_CONN
         } else if (lwcell.m.ipd.read) { /* Read connection data */
             size_t len;
@@ -1139,6 +1836,14 @@ lwcelli_process(const void* data, size_t data_len) {
                 if (lwcell.m.ipd.buff != NULL) {    /* Do we have valid buffer? */
                     lwcell.m.ipd.conn->total_recved +=
                         lwcell.m.ipd.buff->tot_len; /* Increase number of bytes received */
+#if LWCELL_CFG_CONN_MANUAL_RX
+                    if (lwcell.m.ipd.conn->status.f.rx_manual_ack) {
+                        lwcell.m.ipd.conn->rx_unacked += lwcell.m.ipd.buff->tot_len; /* Wait for application to confirm */
+                    }
+#endif /* LWCELL_CFG_CONN_MANUAL_RX */
+#if LWCELL_CFG_CONN_STATS
+                    lwcelli_conn_stats_recv(lwcell.m.ipd.conn, lwcell.m.ipd.buff->tot_len);
+#endif /* LWCELL_CFG_CONN_STATS */
 
                     /*
                      * Send data buffer to upper layer
@@ -1180,6 +1885,11 @@ lwcelli_process(const void* data, size_t data_len) {
                         LWCELL_DEBUGW(LWCELL_CFG_DBG_IPD | LWCELL_DBG_TYPE_TRACE | LWCELL_DBG_LVL_WARNING,
                                       lwcell.m.ipd.buff == NULL,
                                       "[LWCELL IPD] Buffer allocation failed for %d bytes\r\n", (int)new_len);
+#if LWCELL_CFG_CONN_STATS
+                        if (lwcell.m.ipd.buff == NULL) {
+                            ++lwcell.m.ipd.conn->stats.rx_alloc_fails;
+                        }
+#endif /* LWCELL_CFG_CONN_STATS */
                     } else {
                         lwcell.m.ipd.buff = NULL; /* Reset it */
                     }
@@ -1202,6 +1912,39 @@ lwcelli_process(const void* data, size_t data_len) {
                 lwcelli_parse_cops_scan(ch, 0); /* Parse character by character */
             }
 #if LWCELL_CFG_SMS
+#if LWCELL_CFG_SMS_DIRECT
+        } else if (lwcell.m.sms.cmt_read) {
+            lwcell_sms_entry_t* e = &lwcell.m.sms.cmt_entry;
+#if LWCELL_CFG_SMS_PDU
+            if (lwcell.m.sms.cmt_read == 2) {
+                if (lwcelli_parse_sms_pdu(e, ch)) {
+                    lwcelli_sms_direct_done();
+                }
+            } else
+#endif /* LWCELL_CFG_SMS_PDU */
+            {
+                if (lwcell.m.sms.cmt_read == 1 && ch != '\r' && ch != '\n' && e->length < (sizeof(e->data) - 1)) {
+                    e->data[e->length++] = ch;
+                }
+                if (ch == '\n' && ch_prev1 == '\r') {
+                    lwcelli_sms_direct_done();
+                }
+            }
+#endif /* LWCELL_CFG_SMS_DIRECT */
+#if LWCELL_CFG_SMS_PDU
+        } else if (CMD_IS_CUR(LWCELL_CMD_CMGR) && lwcell.msg->msg.sms_read.read && !lwcell.msg->msg.sms_read.format) {
+            if (lwcelli_parse_sms_pdu(lwcell.msg->msg.sms_read.read == 2 ? lwcell.msg->msg.sms_read.entry : NULL, ch)) {
+                lwcell.msg->msg.sms_read.read = 0;
+            }
+        } else if (CMD_IS_CUR(LWCELL_CMD_CMGL) && lwcell.msg->msg.sms_list.read && !lwcell.msg->msg.sms_list.format) {
+            if (lwcelli_parse_sms_pdu(
+                    lwcell.msg->msg.sms_list.read == 2 ? LWCELL_SMS_LIST_ENTRY(lwcell.msg) : NULL, ch)) {
+                if (lwcell.msg->msg.sms_list.read == 2) {
+                    lwcelli_sms_list_entry_done(lwcell.msg);
+                }
+                lwcell.msg->msg.sms_list.read = 0;
+            }
+#endif /* LWCELL_CFG_SMS_PDU */
         } else if (CMD_IS_CUR(LWCELL_CMD_CMGR) && lwcell.msg->msg.sms_read.read) {
             lwcell_sms_entry_t* e = lwcell.msg->msg.sms_read.entry;
             if (lwcell.msg->msg.sms_read.read == 2) { /* Read only if set to 2 */
@@ -1219,17 +1962,14 @@ lwcelli_process(const void* data, size_t data_len) {
             }
         } else if (CMD_IS_CUR(LWCELL_CMD_CMGL) && lwcell.msg->msg.sms_list.read) {
             if (lwcell.msg->msg.sms_list.read == 2) {
-                lwcell_sms_entry_t* e = &lwcell.msg->msg.sms_list.entries[lwcell.msg->msg.sms_list.ei];
+                lwcell_sms_entry_t* e = LWCELL_SMS_LIST_ENTRY(lwcell.msg);
                 if (e->length < (sizeof(e->data) - 1)) {
                     e->data[e->length++] = ch;
                 }
             }
             if (ch == '\n' && ch_prev1 == '\r') {
                 if (lwcell.msg->msg.sms_list.read == 2) {
-                    ++lwcell.msg->msg.sms_list.ei;             /* Go to next entry */
-                    if (lwcell.msg->msg.sms_list.er != NULL) { /* Check and update user variable */
-                        *lwcell.msg->msg.sms_list.er = lwcell.msg->msg.sms_list.ei;
-                    }
+                    lwcelli_sms_list_entry_done(lwcell.msg);
                 }
                 lwcell.msg->msg.sms_list.read = 0;
             }
@@ -1293,13 +2033,23 @@ lwcelli_process(const void* data, size_t data_len) {
                          *  - Connection is active and
                          *  - Connection is not in closing mode
                          */
-                        if (lwcell.m.ipd.conn->status.f.active && !lwcell.m.ipd.conn->status.f.in_closing) {
+                        if (0) {
+#if LWCELL_CFG_CONN_MANUAL_RX
+                        } else if (lwcell.m.ipd.buff != NULL) {
+                            len = lwcell.m.ipd.buff->len; /* Buffer was allocated when read command was sent */
+#endif                                                    /* LWCELL_CFG_CONN_MANUAL_RX */
+                        } else if (lwcell.m.ipd.conn->status.f.active && !lwcell.m.ipd.conn->status.f.in_closing) {
                             do {
                                 lwcell.m.ipd.buff = lwcell_pbuf_new(len); /* Allocate new packet buffer */
                             } while (lwcell.m.ipd.buff == NULL && (len = (len >> 1)) >= LWCELL_CFG_CONN_MIN_DATA_LEN);
                             LWCELL_DEBUGW(LWCELL_CFG_DBG_IPD | LWCELL_DBG_TYPE_TRACE | LWCELL_DBG_LVL_WARNING,
                                           lwcell.m.ipd.buff == NULL,
                                           "[LWCELL IPD] Buffer allocation failed for %d byte(s)\r\n", (int)len);
+#if LWCELL_CFG_CONN_STATS
+                            if (lwcell.m.ipd.buff == NULL) {
+                                ++lwcell.m.ipd.conn->stats.rx_alloc_fails;
+                            }
+#endif /* LWCELL_CFG_CONN_STATS */
                         } else {
                             lwcell.m.ipd.buff = NULL; /* Ignore reading on closed connection */
                             LWCELL_DEBUGF(LWCELL_CFG_DBG_IPD | LWCELL_DBG_TYPE_TRACE,
@@ -1321,6 +2071,18 @@ lwcelli_process(const void* data, size_t data_len) {
 #if LWCELL_CFG_CONN
                         } else if (CMD_IS_CUR(LWCELL_CMD_CIPSEND)) {
                             RECV_RESET(); /* Reset received object */
+#if LWCELL_CFG_CONN_STATS
+                            {
+                                lwcell_conn_stats_t* s = &lwcell.msg->msg.conn_send.conn->stats;
+                                uint32_t now = lwcell_sys_now();
+
+                                ++s->tx_prompts;
+                                s->prompt_latency_sum += now - lwcell.msg->msg.conn_send.send_time;
+                                s->prompt_latency_max =
+                                    LWCELL_MAX(s->prompt_latency_max, now - lwcell.msg->msg.conn_send.send_time);
+                                lwcell.msg->msg.conn_send.data_time = now;
+                            }
+#endif /* LWCELL_CFG_CONN_STATS */
 
                             /* Now actually send the data prepared before */
                             AT_PORT_SEND_WITH_FLUSH(&lwcell.msg->msg.conn_send.data[lwcell.msg->msg.conn_send.ptr],
@@ -1329,8 +2091,24 @@ lwcelli_process(const void* data, size_t data_len) {
                                 1;                                /* Now we are waiting for "SEND OK" or "SEND ERROR" */
 #endif                                                            /* LWCELL_CFG_CONN */
 #if LWCELL_CFG_SMS
+#if LWCELL_CFG_CMD_HANDLE
+                        } else if (CMD_IS_CUR(LWCELL_CMD_CMGS) && lwcell.msg->cancel) {
+                            AT_PORT_SEND_CONST_STR("\x1B"); /* Escape discards message instead of sending it */
+                            AT_PORT_SEND_FLUSH();
+#endif                                                    /* LWCELL_CFG_CMD_HANDLE */
                         } else if (CMD_IS_CUR(LWCELL_CMD_CMGS)) { /* Send SMS? */
-                            AT_PORT_SEND(lwcell.msg->msg.sms_send.text, strlen(lwcell.msg->msg.sms_send.text));
+#if LWCELL_CFG_CMD_HANDLE
+                            lwcell.msg->msg.sms_send.prompt = 1;
+#endif /* LWCELL_CFG_CMD_HANDLE */
+#if LWCELL_CFG_SMS_PDU
+                            if (!lwcell.msg->msg.sms_send.format) {
+                                /* PDU encoded for AT+CMGS=<n>, received messages use separate buffer */
+                                lwcelli_send_hex(lwcell.m.sms.pdu, lwcell.m.sms.pdu_len);
+                            } else
+#endif /* LWCELL_CFG_SMS_PDU */
+                            {
+                                AT_PORT_SEND(lwcell.msg->msg.sms_send.text, strlen(lwcell.msg->msg.sms_send.text));
+                            }
                             AT_PORT_SEND_CTRL_Z();
                             AT_PORT_SEND_FLUSH();
 #endif /* LWCELL_CFG_SMS */
@@ -1370,6 +2148,206 @@ lwcelli_process(const void* data, size_t data_len) {
     return lwcellOK;
 }
 
+#if LWCELL_CFG_SMS || __DOXYGEN__
+
+/**
+ * \brief           Get SMS message format required by current message
+ * \param[in]       msg: Pointer to current message
+ * \return          `1` for text mode, `0` for PDU mode
+ */
+static uint8_t
+lwcelli_sms_get_format(lwcell_msg_t* msg) {
+    if (CMD_IS_DEF(LWCELL_CMD_CMGS)) {
+        return !!msg->msg.sms_send.format;
+    } else if (CMD_IS_DEF(LWCELL_CMD_CMGR)) {
+        return !!msg->msg.sms_read.format;
+    } else if (CMD_IS_DEF(LWCELL_CMD_CMGL)) {
+        return !!msg->msg.sms_list.format;
+#if LWCELL_CFG_SMS_DIRECT
+    } else if (CMD_IS_DEF(LWCELL_CMD_CNMI)) {
+        return !!msg->msg.sms_direct.format;
+#endif /* LWCELL_CFG_SMS_DIRECT */
+    }
+    return 1; /* Used for all other operations like delete all messages, etc */
+}
+
+/**
+ * \brief           Get SMS memory to set with `AT+CPMS` command for current message
+ * \param[in]       msg: Pointer to current message
+ * \param[in]       idx: Memory index, `0` = read/delete, `1` = sent/write, `2` = receive
+ * \return          Memory to set or \ref LWCELL_MEM_END if current message does not set memory at index
+ */
+static lwcell_mem_t
+lwcelli_sms_get_mem(lwcell_msg_t* msg, size_t idx) {
+    lwcell_mem_t mem = LWCELL_MEM_END;
+
+    if (CMD_IS_DEF(LWCELL_CMD_CPMS_SET)) { /* Set memory for read/delete,sent/write,receive */
+        mem = msg->msg.sms_memory.mem[idx];
+    } else if (idx > 0) {                  /* Other commands set first memory only */
+        return LWCELL_MEM_END;
+    } else if (CMD_IS_DEF(LWCELL_CMD_CMGR)) {
+        mem = msg->msg.sms_read.mem;
+    } else if (CMD_IS_DEF(LWCELL_CMD_CMGD)) {
+        mem = msg->msg.sms_delete.mem;
+    } else if (CMD_IS_DEF(LWCELL_CMD_CMGL)) {
+        mem = msg->msg.sms_list.mem;
+    }
+    return mem == LWCELL_MEM_CURRENT ? lwcell.m.sms.mem[idx].current : mem;
+}
+
+#endif /* LWCELL_CFG_SMS || __DOXYGEN__ */
+
+#if LWCELL_CFG_PHONEBOOK || __DOXYGEN__
+
+/**
+ * \brief           Get phonebook memory to set with `AT+CPBS` command for current message
+ * \param[in]       msg: Pointer to current message
+ * \return          Memory to set or \ref LWCELL_MEM_END if current message does not set memory
+ */
+static lwcell_mem_t
+lwcelli_pb_get_mem(lwcell_msg_t* msg) {
+    lwcell_mem_t mem;
+
+    switch (CMD_GET_DEF()) {
+        case LWCELL_CMD_CPBW_SET: mem = msg->msg.pb_write.mem; break;
+        case LWCELL_CMD_CPBR: mem = msg->msg.pb_list.mem; break;
+        case LWCELL_CMD_CPBF: mem = msg->msg.pb_search.mem; break;
+        default: return LWCELL_MEM_END;
+    }
+    return mem == LWCELL_MEM_CURRENT ? lwcell.m.pb.mem.current : mem;
+}
+
+#endif /* LWCELL_CFG_PHONEBOOK || __DOXYGEN__ */
+
+#if LWCELL_CFG_MODEM_SHADOW || __DOXYGEN__
+
+/**
+ * \brief           Update modem settings shadow after current command finished
+ * \param[in]       msg: Pointer to current message
+ * \param[in]       is_ok: Set to `1` if command finished with success
+ */
+static void
+lwcelli_shadow_update(lwcell_msg_t* msg, uint8_t is_ok) {
+    switch (CMD_GET_CUR()) {
+#if LWCELL_CFG_SMS
+        case LWCELL_CMD_CMGF: {
+            lwcell.m.shadow.sms_format = lwcelli_sms_get_format(msg);
+            lwcell.m.shadow.sms_format_valid = is_ok;
+            break;
+        }
+        case LWCELL_CMD_CPMS_GET: {
+            lwcell.m.shadow.sms_mem_valid = is_ok ? 0x07 : 0x00; /* All 3 memories are reported */
+            break;
+        }
+        case LWCELL_CMD_CPMS_SET: {
+            if (!is_ok) {
+                lwcell.m.shadow.sms_mem_valid = 0x00; /* Unknown which memories were applied */
+                break;
+            }
+            for (size_t i = 0; i < 3; ++i) {
+                lwcell_mem_t mem = lwcelli_sms_get_mem(msg, i);
+                if (mem == LWCELL_MEM_END) {
+                    break;
+                }
+                lwcell.m.sms.mem[i].current = mem;
+                lwcell.m.shadow.sms_mem_valid |= (uint8_t)(1U << i);
+            }
+            break;
+        }
+#endif /* LWCELL_CFG_SMS */
+#if LWCELL_CFG_PHONEBOOK
+        case LWCELL_CMD_CPBS_GET: {
+            lwcell.m.shadow.pb_mem_valid = is_ok;
+            break;
+        }
+        case LWCELL_CMD_CPBS_SET: {
+            if (is_ok) {
+                lwcell.m.pb.mem.current = lwcelli_pb_get_mem(msg);
+            }
+            lwcell.m.shadow.pb_mem_valid = is_ok;
+            break;
+        }
+#endif /* LWCELL_CFG_PHONEBOOK */
+        default: break;
+    }
+}
+
+/**
+ * \brief           Check if current sub-command can be skipped as device already holds its target state
+ *
+ * Only mode-setting steps of SMS and phonebook command chains are considered,
+ * these are always followed by another command. Command requested by user is never skipped.
+ *
+ * \param[in]       msg: Pointer to current message
+ * \return          `1` if command can be skipped, `0` otherwise
+ */
+static uint8_t
+lwcelli_shadow_cmd_holds(lwcell_msg_t* msg) {
+    switch (CMD_GET_DEF()) {
+#if LWCELL_CFG_SMS
+        case LWCELL_CMD_CMGS:
+        case LWCELL_CMD_CMGR:
+        case LWCELL_CMD_CMGD:
+        case LWCELL_CMD_CMGDA:
+        case LWCELL_CMD_CMGL:
+        case LWCELL_CMD_CPMS_SET:
+#if LWCELL_CFG_SMS_DIRECT
+        case LWCELL_CMD_CNMI:
+#endif /* LWCELL_CFG_SMS_DIRECT */
+#endif /* LWCELL_CFG_SMS */
+#if LWCELL_CFG_PHONEBOOK
+        case LWCELL_CMD_CPBW_SET:
+        case LWCELL_CMD_CPBR:
+        case LWCELL_CMD_CPBF:
+#endif /* LWCELL_CFG_PHONEBOOK */
+            break;
+        default: return 0;
+    }
+    if (CMD_GET_CUR() == CMD_GET_DEF()) {
+        return 0;
+    }
+
+    switch (CMD_GET_CUR()) {
+#if LWCELL_CFG_SMS
+        case LWCELL_CMD_CMGF: {
+            return lwcell.m.shadow.sms_format_valid && lwcell.m.shadow.sms_format == lwcelli_sms_get_format(msg);
+        }
+        case LWCELL_CMD_CPMS_GET: {
+            return lwcell.m.shadow.sms_mem_valid == 0x07;
+        }
+        case LWCELL_CMD_CPMS_SET: {
+            for (size_t i = 0; i < 3; ++i) {
+                lwcell_mem_t mem = lwcelli_sms_get_mem(msg, i);
+                if (mem == LWCELL_MEM_END) {
+                    break;
+                }
+                if (!(lwcell.m.shadow.sms_mem_valid & (1U << i)) || lwcell.m.sms.mem[i].current != mem) {
+                    return 0;
+                }
+            }
+            return 1;
+        }
+#endif /* LWCELL_CFG_SMS */
+#if LWCELL_CFG_PHONEBOOK
+        case LWCELL_CMD_CPBS_GET: {
+#if LWCELL_CFG_PHONEBOOK_MIRROR
+            if (CMD_IS_DEF(LWCELL_CMD_CPBR) && msg->msg.pb_list.mirror) {
+                return 0; /* Mirror needs fresh memory size */
+            }
+#endif /* LWCELL_CFG_PHONEBOOK_MIRROR */
+            return lwcell.m.shadow.pb_mem_valid;
+        }
+        case LWCELL_CMD_CPBS_SET: {
+            return lwcell.m.shadow.pb_mem_valid && lwcell.m.pb.mem.current == lwcelli_pb_get_mem(msg);
+        }
+#endif /* LWCELL_CFG_PHONEBOOK */
+        default: break;
+    }
+    return 0;
+}
+
+#endif /* LWCELL_CFG_MODEM_SHADOW || __DOXYGEN__ */
+
 /* Temporary macros, only available for inside lwcelli_process_sub_cmd function */
 /* Set new command, but first check for error on previous */
 #define SET_NEW_CMD_CHECK_ERROR(new_cmd)                                                                               \
@@ -1396,6 +2374,14 @@ lwcelli_process(const void* data, size_t data_len) {
 static lwcellr_t
 lwcelli_process_sub_cmd(lwcell_msg_t* msg, lwcell_status_flags_t* stat) {
     lwcell_cmd_t n_cmd = LWCELL_CMD_IDLE;
+#if LWCELL_CFG_MODEM_SHADOW
+    lwcelli_shadow_update(msg, stat->is_ok);
+#endif /* LWCELL_CFG_MODEM_SHADOW */
+#if LWCELL_CFG_CMD_HANDLE
+    if (msg->cancel) {
+        stat->is_ok = 0; /* Aborted command finishes with error and starts no other command */
+    }
+#endif /* LWCELL_CFG_CMD_HANDLE */
     if (CMD_IS_DEF(LWCELL_CMD_RESET)) {
         switch (CMD_GET_CUR()) {                                                     /* Check current command */
             case LWCELL_CMD_RESET: {
@@ -1439,6 +2425,9 @@ lwcelli_process_sub_cmd(lwcell_msg_t* msg, lwcell_status_flags_t* stat) {
         }
     } else if (CMD_IS_DEF(LWCELL_CMD_COPS_GET_OPT)) {
         if (CMD_IS_CUR(LWCELL_CMD_COPS_GET_OPT)) {
+            if (msg->msg.cops_scan.cancel) {
+                stat->is_ok = 1; /* Aborted by user, entries received so far are valid */
+            }
             OPERATOR_SCAN_SEND_EVT(lwcell.msg, stat->is_ok ? lwcellOK : lwcellERR);
         }
     } else if (CMD_IS_DEF(LWCELL_CMD_SIM_PROCESS_BASIC_CMDS)) {
@@ -1504,12 +2493,30 @@ lwcelli_process_sub_cmd(lwcell_msg_t* msg, lwcell_status_flags_t* stat) {
     } else if (CMD_IS_DEF(LWCELL_CMD_CMGS)) {                /* Send SMS default command */
         if (CMD_IS_CUR(LWCELL_CMD_CMGF) && stat->is_ok) {    /* Set message format current command */
             SET_NEW_CMD(LWCELL_CMD_CMGS);                    /* Now send actual message */
-        }
-
-        /* Send event on finish */
-        if (n_cmd == LWCELL_CMD_IDLE) {
-            SMS_SEND_SEND_EVT(lwcell.msg, stat->is_ok ? lwcellOK : lwcellERR);
-        }
+#if LWCELL_CFG_SMS_PDU
+            if (!msg->msg.sms_send.format && msg->msg.sms_send.total > 1) {
+                msg->msg.sms_send.ref = ++lwcell.m.sms.concat_ref; /* New reference for all parts */
+            }
+        } else if (CMD_IS_CUR(LWCELL_CMD_CMGS) && stat->is_ok && !msg->msg.sms_send.format
+                   && msg->msg.sms_send.seq < msg->msg.sms_send.total) {
+            msg->msg.sms_send.off += msg->msg.sms_send.part_len; /* Continue with next part */
+            ++msg->msg.sms_send.seq;
+            SET_NEW_CMD(LWCELL_CMD_CMGS);
+#endif /* LWCELL_CFG_SMS_PDU */
+        }
+
+#if LWCELL_CFG_SMS_BULK
+        if (msg->msg.sms_send.bulk != NULL) {
+            /* Bulk job reports recipient, next one is queued as new command */
+            n_cmd = lwcelli_sms_bulk_process(msg, stat->is_ok ? lwcellOK : lwcellERR) ? LWCELL_CMD_CMGS
+                                                                                      : LWCELL_CMD_IDLE;
+            stat->is_ok = 1;
+        } else
+#endif /* LWCELL_CFG_SMS_BULK */
+            /* Send event on finish */
+            if (n_cmd == LWCELL_CMD_IDLE) {
+                SMS_SEND_SEND_EVT(lwcell.msg, stat->is_ok ? lwcellOK : lwcellERR);
+            }
     } else if (CMD_IS_DEF(LWCELL_CMD_CMGR)) {                    /* Read SMS message */
         if (CMD_IS_CUR(LWCELL_CMD_CPMS_GET) && stat->is_ok) {
             SET_NEW_CMD(LWCELL_CMD_CPMS_SET);                    /* Set memory */
@@ -1553,6 +2560,18 @@ lwcelli_process_sub_cmd(lwcell_msg_t* msg, lwcell_status_flags_t* stat) {
         if (n_cmd == LWCELL_CMD_IDLE) {
             SMS_SEND_LIST_EVT(msg, stat->is_ok ? lwcellOK : lwcellERR);
         }
+#if LWCELL_CFG_SMS_DIRECT
+    } else if (CMD_IS_DEF(LWCELL_CMD_CNMI)) { /* Set direct SMS delivery */
+        if (CMD_IS_CUR(LWCELL_CMD_CMGF) && stat->is_ok) {
+            /* Acknowledgement requires phase 2+ message service */
+            SET_NEW_CMD(msg->msg.sms_direct.en && msg->msg.sms_direct.ack ? LWCELL_CMD_CSMS : LWCELL_CMD_CNMI);
+        } else if (CMD_IS_CUR(LWCELL_CMD_CSMS) && stat->is_ok) {
+            SET_NEW_CMD(LWCELL_CMD_CNMI);
+        } else if (CMD_IS_CUR(LWCELL_CMD_CNMI) && stat->is_ok) {
+            lwcell.m.sms.direct = msg->msg.sms_direct.en;
+            lwcell.m.sms.direct_ack = msg->msg.sms_direct.en && msg->msg.sms_direct.ack;
+        }
+#endif /* LWCELL_CFG_SMS_DIRECT */
     } else if (CMD_IS_DEF(LWCELL_CMD_CPMS_SET)) { /* Set preferred memory */
         if (CMD_IS_CUR(LWCELL_CMD_CPMS_GET) && stat->is_ok) {
             SET_NEW_CMD(LWCELL_CMD_CPMS_SET);     /* Now set the command */
@@ -1574,8 +2593,26 @@ lwcelli_process_sub_cmd(lwcell_msg_t* msg, lwcell_status_flags_t* stat) {
             SET_NEW_CMD(LWCELL_CMD_CPBS_SET);                 /* Set current memory */
         } else if (CMD_IS_CUR(LWCELL_CMD_CPBS_SET) && stat->is_ok) {
             SET_NEW_CMD(LWCELL_CMD_CPBW_SET);                 /* Write entry to phonebook */
+#if LWCELL_CFG_PHONEBOOK_MIRROR
+        } else if (CMD_IS_CUR(LWCELL_CMD_CPBW_SET) && stat->is_ok) {
+            lwcelli_pb_mirror_write(msg); /* Keep local mirror coherent */
+#endif                                    /* LWCELL_CFG_PHONEBOOK_MIRROR */
         }
     } else if (CMD_IS_DEF(LWCELL_CMD_CPBR)) {
+#if LWCELL_CFG_PHONEBOOK_MIRROR
+        if (CMD_IS_CUR(LWCELL_CMD_CPBS_GET) && stat->is_ok && msg->msg.pb_list.mirror == 2) {
+            if (lwcell.m.pb.mem.total > 0) {
+                SET_NEW_CMD(LWCELL_CMD_CPBR); /* Read all entries */
+            } else {
+                stat->is_ok = lwcelli_pb_mirror_loaded(msg, 1);
+            }
+        } else if (CMD_IS_CUR(LWCELL_CMD_CPBS_SET) && stat->is_ok && msg->msg.pb_list.mirror) {
+            msg->msg.pb_list.mirror = 2;
+            SET_NEW_CMD(LWCELL_CMD_CPBS_GET); /* Get memory size */
+        } else if (CMD_IS_CUR(LWCELL_CMD_CPBR) && msg->msg.pb_list.mirror) {
+            stat->is_ok = lwcelli_pb_mirror_loaded(msg, stat->is_ok);
+        } else
+#endif                                                        /* LWCELL_CFG_PHONEBOOK_MIRROR */
         if (CMD_IS_CUR(LWCELL_CMD_CPBS_GET) && stat->is_ok) { /* Get current memory */
             SET_NEW_CMD(LWCELL_CMD_CPBS_SET);                 /* Set current memory */
         } else if (CMD_IS_CUR(LWCELL_CMD_CPBS_SET) && stat->is_ok) {
@@ -1615,10 +2652,19 @@ lwcelli_process_sub_cmd(lwcell_msg_t* msg, lwcell_status_flags_t* stat) {
             case 4: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CIPSHUT); break;
             case 5: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CIPMUX_SET); break;
             case 6: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CIPRXGET_SET); break;
+#if LWCELL_CFG_CONN_TRANSPARENT
+            case 7: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CIPMODE); break;
+            case 8: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CIPCCFG); break;
+            case 9: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CSTT_SET); break;
+            case 10: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CIICR); break;
+            case 11: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CIFSR); break;
+            case 12: SET_NEW_CMD(LWCELL_CMD_CIPSTATUS); break;
+#else  /* LWCELL_CFG_CONN_TRANSPARENT */
             case 7: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CSTT_SET); break;
             case 8: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CIICR); break;
             case 9: SET_NEW_CMD_CHECK_ERROR(LWCELL_CMD_CIFSR); break;
             case 10: SET_NEW_CMD(LWCELL_CMD_CIPSTATUS); break;
+#endif /* !LWCELL_CFG_CONN_TRANSPARENT */
             default: break;
         }
     } else if (CMD_IS_DEF(LWCELL_CMD_NETWORK_DETACH)) {
@@ -1641,39 +2687,67 @@ lwcelli_process_sub_cmd(lwcell_msg_t* msg, lwcell_status_flags_t* stat) {
                 SET_NEW_CMD(LWCELL_CMD_CIPSSL);            /* Set SSL */
             }
         } else if (msg->i == 1 && CMD_IS_CUR(LWCELL_CMD_CIPSSL)) {
-            SET_NEW_CMD(LWCELL_CMD_CIPSTART);  /* Now actually start connection */
-        } else if (msg->i == 2 && CMD_IS_CUR(LWCELL_CMD_CIPSTART)) {
-            SET_NEW_CMD(LWCELL_CMD_CIPSTATUS); /* Go to status mode */
+#if LWCELL_CFG_DNS
+            /* Resolve host first, SSL connections use host name for verification */
+            if (msg->msg.conn_start.type != LWCELL_CONN_TYPE_SSL
+                && lwcelli_dns_cache_need_resolve(msg->msg.conn_start.host)) {
+                SET_NEW_CMD(LWCELL_CMD_CDNSGIP);
+            } else {
+                SET_NEW_CMD(LWCELL_CMD_CIPSTART); /* Now actually start connection */
+            }
+        } else if (CMD_IS_CUR(LWCELL_CMD_CDNSGIP)) {
+            /* On resolve failure, device tries to resolve host again itself */
+            SET_NEW_CMD(LWCELL_CMD_CIPSTART); /* Now actually start connection */
+#else                                         /* LWCELL_CFG_DNS */
+            SET_NEW_CMD(LWCELL_CMD_CIPSTART); /* Now actually start connection */
+#endif                                        /* !LWCELL_CFG_DNS */
+        } else if (CMD_IS_CUR(LWCELL_CMD_CIPSTART)) {
             if (stat->is_error) {
                 msg->msg.conn_start.conn_res = LWCELL_CONN_CONNECT_ERROR;
             }
-        } else if (msg->i == 3 && CMD_IS_CUR(LWCELL_CMD_CIPSTATUS)) {
-            /* After second CIP status, define what to do next */
-            switch (msg->msg.conn_start.conn_res) {
-                case LWCELL_CONN_CONNECT_OK: {                                      /* Successfully connected */
-                    lwcell_conn_t* conn = &lwcell.m.conns[msg->msg.conn_start.num]; /* Get connection number */
-
-                    lwcell.evt.type = LWCELL_EVT_CONN_ACTIVE;                       /* Connection just active */
-                    lwcell.evt.evt.conn_active_close.client = 1;
-                    lwcell.evt.evt.conn_active_close.conn = conn;
-                    lwcell.evt.evt.conn_active_close.forced = 1;
-                    lwcelli_send_conn_cb(conn, NULL);
-                    lwcelli_conn_start_timeout(conn); /* Start connection timeout timer */
-                    break;
-                }
-                case LWCELL_CONN_CONNECT_ERROR: { /* Connection error */
-                    lwcelli_send_conn_error_cb(msg, lwcellERRCONNFAIL);
-                    stat->is_error = 1;           /* Manually set error */
-                    stat->is_ok = 0;              /* Reset success */
-                    break;
-                }
-                default: {
-                    /* Do nothing as of now */
-                    break;
-                }
+#if LWCELL_CFG_CONN_TRANSPARENT
+            /* Device is already in data mode, status cannot be checked with AT+CIPSTATUS */
+            lwcelli_conn_start_finish(msg, stat);
+#else  /* LWCELL_CFG_CONN_TRANSPARENT */
+            SET_NEW_CMD(LWCELL_CMD_CIPSTATUS); /* Go to status mode */
+#endif /* !LWCELL_CFG_CONN_TRANSPARENT */
+        } else if (CMD_IS_CUR(LWCELL_CMD_CIPSTATUS)) {
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND
+            if (msg->msg.conn_start.conn_res == LWCELL_CONN_CONNECT_OK) {
+                SET_NEW_CMD(LWCELL_CMD_CIPSEND_GET); /* Get maximal data length before connection is reported */
+            } else {
+                lwcelli_conn_start_finish(msg, stat);
+            }
+        } else if (CMD_IS_CUR(LWCELL_CMD_CIPSEND_GET)) {
+            /* Connection is active regardless of query result, default length is used on error */
+            stat->is_ok = 1;
+            stat->is_error = 0;
+            lwcelli_conn_start_finish(msg, stat);
+#else                                             /* LWCELL_CFG_CONN_ADAPTIVE_SEND */
+            lwcelli_conn_start_finish(msg, stat); /* After second CIP status, define what to do next */
+#endif                                            /* !LWCELL_CFG_CONN_ADAPTIVE_SEND */
+        }
+#if LWCELL_CFG_CONN_MANUAL_RX
+    } else if (CMD_IS_DEF(LWCELL_CMD_CIPRXGET)) {
+        lwcell_conn_t* c = msg->msg.conn_recv.conn;
+
+        lwcell_pbuf_free_s(&msg->msg.conn_recv.buff); /* Buffer was not used for data */
+        if (c->val_id == msg->msg.conn_recv.val_id) {
+            /* Continue reading while device has data and application accepts more */
+            if (stat->is_ok && c->status.f.active && !c->status.f.in_closing && c->status.f.rx_avail
+                && c->rx_unacked < LWCELL_CFG_CONN_MANUAL_RX_WINDOW) {
+                SET_NEW_CMD(LWCELL_CMD_CIPRXGET);
+            } else {
+                c->status.f.rx_read_queued = 0;
             }
         }
+#endif /* LWCELL_CFG_CONN_MANUAL_RX */
     } else if (CMD_IS_DEF(LWCELL_CMD_CIPCLOSE)) {
+#if LWCELL_CFG_CONN_TRANSPARENT
+        if (CMD_IS_CUR(LWCELL_CMD_PPP) && stat->is_ok) {
+            SET_NEW_CMD(LWCELL_CMD_CIPCLOSE); /* Device is in command mode, close connection now */
+        }
+#endif /* LWCELL_CFG_CONN_TRANSPARENT */
         /*
          * It is unclear in which state connection is when ERROR is received on close command.
          * Stack checks if connection is closed before it allows and sends close command,
@@ -1729,6 +2803,26 @@ lwcelli_process_sub_cmd(lwcell_msg_t* msg, lwcell_status_flags_t* stat) {
  */
 lwcellr_t
 lwcelli_initiate_cmd(lwcell_msg_t* msg) {
+#if LWCELL_CFG_CONN_TRANSPARENT
+    /* In data mode, modem only accepts raw data or escape sequence */
+    if (lwcell.m.data_mode && !CMD_IS_CUR(LWCELL_CMD_CIPSEND) && !CMD_IS_CUR(LWCELL_CMD_PPP)) {
+        return lwcellERR;
+    }
+#endif /* LWCELL_CFG_CONN_TRANSPARENT */
+#if LWCELL_CFG_MODEM_SHADOW
+    /* Skip sub-command and continue with next one when device already holds its target state */
+    if (lwcelli_shadow_cmd_holds(msg)) {
+        lwcell_status_flags_t stat = {0};
+        lwcellr_t res;
+
+        stat.is_ok = 1;
+        if ((res = lwcelli_process_sub_cmd(msg, &stat)) == lwcellCONT) {
+            ++msg->i; /* Skipped command counts as processed */
+            res = lwcellOK;
+        }
+        return res;
+    }
+#endif                           /* LWCELL_CFG_MODEM_SHADOW */
     switch (CMD_GET_CUR()) {     /* Check current message we want to send over AT */
         case LWCELL_CMD_RESET: { /* Reset modem with AT commands */
             /* Try with hardware reset */
@@ -1887,6 +2981,9 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
             break;
         }
         case LWCELL_CMD_COPS_GET_OPT: { /* Get list of available operators */
+            if (msg->msg.cops_scan.cancel) {
+                return lwcellERR; /* Cancelled before it started */
+            }
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+COPS=?");
             AT_PORT_SEND_END_AT();
@@ -1942,7 +3039,14 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
             /* Do we have network connection? */
             /* Check if we are connected to network */
 
-            msg->msg.conn_start.num = 0;                              /* Start with max value = invalidated */
+            msg->msg.conn_start.num = 0; /* Start with max value = invalidated */
+#if LWCELL_CFG_CONN_TRANSPARENT
+            /* Transparent mode supports single connection only */
+            if (!lwcell.m.conns[0].status.f.active) {
+                c = &lwcell.m.conns[0];
+                c->num = 0;
+            }
+#else  /* LWCELL_CFG_CONN_TRANSPARENT */
             for (int16_t i = LWCELL_CFG_MAX_CONNS - 1; i >= 0; --i) { /* Find available connection */
                 if (!lwcell.m.conns[i].status.f.active) {
                     c = &lwcell.m.conns[i];
@@ -1951,6 +3055,7 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
                     break;
                 }
             }
+#endif /* !LWCELL_CFG_CONN_TRANSPARENT */
             if (c == NULL) {
                 lwcelli_send_conn_error_cb(msg, lwcellERRNOFREECONN);
                 return lwcellERRNOFREECONN; /* We don't have available connection */
@@ -1962,13 +3067,31 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
 
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CIPSTART=");
+#if LWCELL_CFG_CONN_TRANSPARENT
+            lwcelli_send_string(msg->msg.conn_start.type == LWCELL_CONN_TYPE_UDP ? "UDP" : "TCP", 0, 1, 0);
+#else  /* LWCELL_CFG_CONN_TRANSPARENT */
             lwcelli_send_number(LWCELL_U32(c->num), 0, 0);
             if (msg->msg.conn_start.type == LWCELL_CONN_TYPE_UDP) {
                 lwcelli_send_string("UDP", 0, 1, 1);
             } else {
                 lwcelli_send_string("TCP", 0, 1, 1);
             }
+#endif /* !LWCELL_CFG_CONN_TRANSPARENT */
+#if LWCELL_CFG_DNS
+            {
+                lwcell_ip_t ip;
+
+                /* Use resolved address to skip device side host lookup */
+                if (msg->msg.conn_start.type != LWCELL_CONN_TYPE_SSL
+                    && lwcelli_dns_cache_lookup(msg->msg.conn_start.host, &ip)) {
+                    lwcelli_send_ip_mac(&ip, 1, 1, 1);
+                } else {
+                    lwcelli_send_string(msg->msg.conn_start.host, 0, 1, 1);
+                }
+            }
+#else  /* LWCELL_CFG_DNS */
             lwcelli_send_string(msg->msg.conn_start.host, 0, 1, 1);
+#endif /* !LWCELL_CFG_DNS */
             lwcelli_send_port(msg->msg.conn_start.port, 0, 1);
             AT_PORT_SEND_END_AT();
             break;
@@ -1981,43 +3104,152 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
                 return lwcellERR;
             }
             AT_PORT_SEND_BEGIN_AT();
+#if LWCELL_CFG_CONN_TRANSPARENT
+            AT_PORT_SEND_CONST_STR("+CIPCLOSE");
+#else  /* LWCELL_CFG_CONN_TRANSPARENT */
             AT_PORT_SEND_CONST_STR("+CIPCLOSE=");
             lwcelli_send_number(
                 LWCELL_U32(msg->msg.conn_close.conn ? msg->msg.conn_close.conn->num : LWCELL_CFG_MAX_CONNS), 0, 0);
+#endif /* !LWCELL_CFG_CONN_TRANSPARENT */
             AT_PORT_SEND_END_AT();
             break;
         }
-        case LWCELL_CMD_CIPSEND: {                    /* Send data to connection */
+        case LWCELL_CMD_CIPSEND: { /* Send data to connection */
+#if LWCELL_CFG_CONN_TRANSPARENT
+            return lwcelli_tcpip_process_send_data_transparent(); /* Write raw data */
+#else                                                             /* LWCELL_CFG_CONN_TRANSPARENT */
             return lwcelli_tcpip_process_send_data(); /* Process send data */
+#endif                                                            /* !LWCELL_CFG_CONN_TRANSPARENT */
+        }
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND
+        case LWCELL_CMD_CIPSEND_GET: { /* Get maximal data length for connections */
+            AT_PORT_SEND_BEGIN_AT();
+            AT_PORT_SEND_CONST_STR("+CIPSEND?");
+            AT_PORT_SEND_END_AT();
+            break;
+        }
+#endif /* LWCELL_CFG_CONN_ADAPTIVE_SEND */
+#if LWCELL_CFG_CONN_TRANSPARENT
+        case LWCELL_CMD_PPP: { /* Escape from data mode */
+            if (lwcell.m.data_mode) {
+                /* Guard time before escape sequence; let other threads run meanwhile */
+                lwcell_core_unlock();
+                lwcell_delay(LWCELL_CFG_CONN_TRANSPARENT_GUARD_TIME);
+                lwcell_core_lock();
+                if (lwcell.m.data_mode_close_ptr > 0) { /* Bytes held back are data */
+                    lwcelli_transparent_recv(&lwcell.m.conns[0], (const uint8_t*)transparent_close_seq,
+                                             lwcell.m.data_mode_close_ptr);
+                }
+                lwcell.m.data_mode = 0;
+                lwcell.m.data_mode_close_ptr = 0;
+
+                /* Escape sequence must not be followed by CR/LF */
+                AT_PORT_SEND_CONST_STR("+++");
+                AT_PORT_SEND_FLUSH();
+            } else {
+                /* Already in command mode, use dummy command to get OK */
+                AT_PORT_SEND_BEGIN_AT();
+                AT_PORT_SEND_END_AT();
+            }
+            break;
+        }
+        case LWCELL_CMD_ATO: { /* Resume data mode */
+            AT_PORT_SEND_CONST_STR("ATO");
+            AT_PORT_SEND_END_AT();
+            break;
+        }
+#endif /* LWCELL_CFG_CONN_TRANSPARENT */
+#if LWCELL_CFG_CONN_MANUAL_RX
+        case LWCELL_CMD_CIPRXGET: { /* Read received data from device buffer */
+            lwcell_conn_p c = msg->msg.conn_recv.conn;
+            size_t len;
+
+            /* Is connection already closed or command for this connection is not valid anymore? */
+            if (!lwcell_conn_is_active(c) || c->val_id != msg->msg.conn_recv.val_id) {
+                return lwcellERR;
+            }
+
+            /* Limit read length to receive window and to available memory */
+            len = c->rx_unacked < LWCELL_CFG_CONN_MANUAL_RX_WINDOW ? (LWCELL_CFG_CONN_MANUAL_RX_WINDOW - c->rx_unacked)
+                                                                   : 0;
+            len = LWCELL_MIN(len, LWCELL_CFG_CONN_MAX_DATA_LEN);
+            if (len == 0) {
+                c->status.f.rx_read_queued = 0; /* Continue when application confirms received data */
+                return lwcellERR;
+            }
+            do {
+                msg->msg.conn_recv.buff = lwcell_pbuf_new(len); /* Allocate new packet buffer */
+            } while (msg->msg.conn_recv.buff == NULL && (len = (len >> 1)) >= LWCELL_CFG_CONN_MIN_DATA_LEN);
+            if (msg->msg.conn_recv.buff == NULL) {
+                LWCELL_DEBUGF(LWCELL_CFG_DBG_IPD | LWCELL_DBG_TYPE_TRACE | LWCELL_DBG_LVL_WARNING,
+                              "[LWCELL IPD] No memory to read data on connection %d, retry later\r\n", (int)c->num);
+#if LWCELL_CFG_CONN_STATS
+                ++c->stats.rx_alloc_fails;
+#endif /* LWCELL_CFG_CONN_STATS */
+                c->status.f.rx_read_queued = 0;
+                lwcelli_conn_manual_rx_retry(c); /* Data stay in device buffer, try again later */
+                return lwcellERRMEM;
+            }
+
+            AT_PORT_SEND_BEGIN_AT();
+            AT_PORT_SEND_CONST_STR("+CIPRXGET=2");
+            lwcelli_send_number(LWCELL_U32(c->num), 0, 1);
+            lwcelli_send_number(LWCELL_U32(len), 0, 1);
+            AT_PORT_SEND_END_AT();
+            break;
         }
+#endif                                        /* LWCELL_CFG_CONN_MANUAL_RX */
         case LWCELL_CMD_CIPSTATUS: {                  /* Get status of device and all connections */
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CIPSTATUS");
             AT_PORT_SEND_END_AT();
             break;
         }
+#if LWCELL_CFG_CONN_SERVER
+        case LWCELL_CMD_CIPSERVER: { /* Enable or disable server */
+            AT_PORT_SEND_BEGIN_AT();
+            AT_PORT_SEND_CONST_STR("+CIPSERVER=");
+            if (msg->msg.tcpip_server.en) {
+                AT_PORT_SEND_CONST_STR("1");
+                lwcelli_send_port(msg->msg.tcpip_server.port, 0, 1);
+            } else {
+                AT_PORT_SEND_CONST_STR("0");
+            }
+            AT_PORT_SEND_END_AT();
+            break;
+        }
+#endif /* LWCELL_CFG_CONN_SERVER */
 #endif                          /* LWCELL_CFG_CONN */
 #if LWCELL_CFG_SMS
         case LWCELL_CMD_CMGF: { /* Select SMS message format */
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CMGF=");
-            if (CMD_IS_DEF(LWCELL_CMD_CMGS)) {
-                lwcelli_send_number(LWCELL_U32(!!msg->msg.sms_send.format), 0, 0);
-            } else if (CMD_IS_DEF(LWCELL_CMD_CMGR)) {
-                lwcelli_send_number(LWCELL_U32(!!msg->msg.sms_read.format), 0, 0);
-            } else if (CMD_IS_DEF(LWCELL_CMD_CMGL)) {
-                lwcelli_send_number(LWCELL_U32(!!msg->msg.sms_list.format), 0, 0);
-            } else {
-                /* Used for all other operations like delete all messages, etc */
-                AT_PORT_SEND_CONST_STR("1");
-            }
+            lwcelli_send_number(LWCELL_U32(lwcelli_sms_get_format(msg)), 0, 0);
             AT_PORT_SEND_END_AT();
             break;
         }
         case LWCELL_CMD_CMGS: { /* Send SMS */
+#if LWCELL_CFG_CMD_HANDLE
+            msg->msg.sms_send.prompt = 0;
+#endif /* LWCELL_CFG_CMD_HANDLE */
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CMGS=");
-            lwcelli_send_string(msg->msg.sms_send.num, 0, 1, 0);
+#if LWCELL_CFG_SMS_PDU
+            if (!msg->msg.sms_send.format) {
+                lwcell.m.sms.pdu_len = lwcelli_sms_pdu_encode(
+                    lwcell.m.sms.pdu, msg->msg.sms_send.num, &msg->msg.sms_send.data[msg->msg.sms_send.off],
+                    msg->msg.sms_send.len - msg->msg.sms_send.off, msg->msg.sms_send.coding, msg->msg.sms_send.ref,
+                    msg->msg.sms_send.total, msg->msg.sms_send.seq, &msg->msg.sms_send.part_len);
+                if (lwcell.m.sms.pdu_len == 0) {
+                    return lwcellERR;
+                }
+                /* Length excludes service center address field */
+                lwcelli_send_number(LWCELL_U32(lwcell.m.sms.pdu_len - 1), 0, 0);
+            } else
+#endif /* LWCELL_CFG_SMS_PDU */
+            {
+                lwcelli_send_string(msg->msg.sms_send.num, 0, 1, 0);
+            }
             AT_PORT_SEND_END_AT();
             break;
         }
@@ -2055,11 +3287,47 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
         case LWCELL_CMD_CMGL: { /* Delete SMS message */
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CMGL=");
-            lwcelli_send_sms_stat(msg->msg.sms_list.status, 1, 0);
+#if LWCELL_CFG_SMS_PDU
+            if (!msg->msg.sms_list.format) {
+                /* Numeric status in PDU mode, in the same order as in text mode */
+                switch (msg->msg.sms_list.status) {
+                    case LWCELL_SMS_STATUS_UNREAD: lwcelli_send_number(0, 0, 0); break;
+                    case LWCELL_SMS_STATUS_READ: lwcelli_send_number(1, 0, 0); break;
+                    case LWCELL_SMS_STATUS_UNSENT: lwcelli_send_number(2, 0, 0); break;
+                    case LWCELL_SMS_STATUS_SENT: lwcelli_send_number(3, 0, 0); break;
+                    default: lwcelli_send_number(4, 0, 0); break;
+                }
+            } else
+#endif /* LWCELL_CFG_SMS_PDU */
+            {
+                lwcelli_send_sms_stat(msg->msg.sms_list.status, 1, 0);
+            }
             lwcelli_send_number(LWCELL_U32(!msg->msg.sms_list.update), 0, 1);
             AT_PORT_SEND_END_AT();
             break;
         }
+#if LWCELL_CFG_SMS_DIRECT
+        case LWCELL_CMD_CSMS: { /* Select message service */
+            AT_PORT_SEND_BEGIN_AT();
+            AT_PORT_SEND_CONST_STR("+CSMS=1");
+            AT_PORT_SEND_END_AT();
+            break;
+        }
+        case LWCELL_CMD_CNMI: { /* New message indications */
+            AT_PORT_SEND_BEGIN_AT();
+            AT_PORT_SEND_CONST_STR("+CNMI=2,");
+            lwcelli_send_number(msg->msg.sms_direct.en ? 2 : 1, 0, 0); /* Route with +CMT or store with +CMTI */
+            AT_PORT_SEND_CONST_STR(",0,0,0");
+            AT_PORT_SEND_END_AT();
+            break;
+        }
+        case LWCELL_CMD_CNMA: { /* Acknowledge directly routed message */
+            AT_PORT_SEND_BEGIN_AT();
+            AT_PORT_SEND_CONST_STR("+CNMA");
+            AT_PORT_SEND_END_AT();
+            break;
+        }
+#endif                                  /* LWCELL_CFG_SMS_DIRECT */
         case LWCELL_CMD_CPMS_GET_OPT: { /* Get available SMS storages */
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CPMS=?");
@@ -2075,26 +3343,12 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
         case LWCELL_CMD_CPMS_SET: { /* Set active SMS storage(s) */
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CPMS=");
-            if (CMD_IS_DEF(LWCELL_CMD_CMGR)) { /* Read SMS original command? */
-                lwcelli_send_dev_memory(msg->msg.sms_read.mem == LWCELL_MEM_CURRENT ? lwcell.m.sms.mem[0].current
-                                                                                    : msg->msg.sms_read.mem,
-                                        1, 0);
-            } else if (CMD_IS_DEF(LWCELL_CMD_CMGD)) { /* Delete SMS original command? */
-                lwcelli_send_dev_memory(msg->msg.sms_delete.mem == LWCELL_MEM_CURRENT ? lwcell.m.sms.mem[0].current
-                                                                                      : msg->msg.sms_delete.mem,
-                                        1, 0);
-            } else if (CMD_IS_DEF(LWCELL_CMD_CMGL)) { /* List SMS original command? */
-                lwcelli_send_dev_memory(msg->msg.sms_list.mem == LWCELL_MEM_CURRENT ? lwcell.m.sms.mem[0].current
-                                                                                    : msg->msg.sms_list.mem,
-                                        1, 0);
-            } else if (CMD_IS_DEF(
-                           LWCELL_CMD_CPMS_SET)) { /* Do we want to set memory for read/delete,sent/write,receive? */
-                for (size_t i = 0; i < 3; ++i) {   /* Write 3 memories */
-                    lwcelli_send_dev_memory(msg->msg.sms_memory.mem[i] == LWCELL_MEM_CURRENT
-                                                ? lwcell.m.sms.mem[i].current
-                                                : msg->msg.sms_memory.mem[i],
-                                            1, !!i);
+            for (size_t i = 0; i < 3; ++i) { /* Read SMS, delete and list set first memory only */
+                lwcell_mem_t mem = lwcelli_sms_get_mem(msg, i);
+                if (mem == LWCELL_MEM_END) {
+                    break;
                 }
+                lwcelli_send_dev_memory(mem, 1, !!i);
             }
             AT_PORT_SEND_END_AT();
             break;
@@ -2136,22 +3390,20 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
             break;
         }
         case LWCELL_CMD_CPBS_SET: { /* Get current memory info */
-            lwcell_mem_t mem;
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CPBS=");
-            switch (CMD_GET_DEF()) {
-                case LWCELL_CMD_CPBW_SET: mem = msg->msg.pb_write.mem; break;
-                case LWCELL_CMD_CPBR: mem = msg->msg.pb_list.mem; break;
-                case LWCELL_CMD_CPBF: mem = msg->msg.pb_search.mem; break;
-                default: break;
-            }
-            lwcelli_send_dev_memory(mem == LWCELL_MEM_CURRENT ? lwcell.m.pb.mem.current : mem, 1, 0);
+            lwcelli_send_dev_memory(lwcelli_pb_get_mem(msg), 1, 0);
             AT_PORT_SEND_END_AT();
             break;
         }
         case LWCELL_CMD_CPBW_SET: { /* Write/Delete new/old entry */
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CPBW=");
+#if LWCELL_CFG_PHONEBOOK_MIRROR
+            if (msg->msg.pb_write.pos == 0) {
+                msg->msg.pb_write.pos = lwcelli_pb_mirror_free_pos(); /* Use known position to keep mirror coherent */
+            }
+#endif                                                                /* LWCELL_CFG_PHONEBOOK_MIRROR */
             if (msg->msg.pb_write.pos > 0) { /* Write number if more than 0 */
                 lwcelli_send_number(LWCELL_U32(msg->msg.pb_write.pos), 0, 0);
             }
@@ -2167,7 +3419,12 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CPBR=");
             lwcelli_send_number(LWCELL_U32(msg->msg.pb_list.start_index), 0, 0);
-            lwcelli_send_number(LWCELL_U32(msg->msg.pb_list.etr), 0, 1);
+#if LWCELL_CFG_PHONEBOOK_MIRROR
+            if (msg->msg.pb_list.mirror) {
+                lwcelli_send_number(LWCELL_U32(lwcell.m.pb.mem.total), 0, 1); /* Read entire memory */
+            } else
+#endif /* LWCELL_CFG_PHONEBOOK_MIRROR */
+                lwcelli_send_number(LWCELL_U32(msg->msg.pb_list.etr), 0, 1);
             AT_PORT_SEND_END_AT();
             break;
         }
@@ -2208,16 +3465,41 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
         }
         case LWCELL_CMD_CIPMUX_SET: {
             AT_PORT_SEND_BEGIN_AT();
+#if LWCELL_CFG_CONN_TRANSPARENT
+            AT_PORT_SEND_CONST_STR("+CIPMUX=0");
+#else  /* LWCELL_CFG_CONN_TRANSPARENT */
             AT_PORT_SEND_CONST_STR("+CIPMUX=1");
+#endif /* !LWCELL_CFG_CONN_TRANSPARENT */
             AT_PORT_SEND_END_AT();
             break;
         }
         case LWCELL_CMD_CIPRXGET_SET: {
             AT_PORT_SEND_BEGIN_AT();
+#if LWCELL_CFG_CONN_MANUAL_RX
+            AT_PORT_SEND_CONST_STR("+CIPRXGET=1");
+#else  /* LWCELL_CFG_CONN_MANUAL_RX */
             AT_PORT_SEND_CONST_STR("+CIPRXGET=0");
+#endif /* !LWCELL_CFG_CONN_MANUAL_RX */
+            AT_PORT_SEND_END_AT();
+            break;
+        }
+#if LWCELL_CFG_CONN_TRANSPARENT
+        case LWCELL_CMD_CIPMODE: {
+            AT_PORT_SEND_BEGIN_AT();
+            AT_PORT_SEND_CONST_STR("+CIPMODE=1");
             AT_PORT_SEND_END_AT();
             break;
         }
+        case LWCELL_CMD_CIPCCFG: {
+            /* Retry count, wait time before sending chunk, chunk size, escape enabled */
+            AT_PORT_SEND_BEGIN_AT();
+            AT_PORT_SEND_CONST_STR("+CIPCCFG=5,2,");
+            lwcelli_send_number(LWCELL_U32(LWCELL_CFG_CONN_MAX_DATA_LEN), 0, 0);
+            AT_PORT_SEND_CONST_STR(",1");
+            AT_PORT_SEND_END_AT();
+            break;
+        }
+#endif /* LWCELL_CFG_CONN_TRANSPARENT */
         case LWCELL_CMD_CSTT_SET: {
             AT_PORT_SEND_BEGIN_AT();
             AT_PORT_SEND_CONST_STR("+CSTT=");
@@ -2240,6 +3522,20 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
             break;
         }
 #endif /* LWCELL_CFG_NETWORK */
+#if LWCELL_CFG_DNS
+        case LWCELL_CMD_CDNSGIP: { /* Resolve host name */
+            const char* host = lwcelli_dns_get_host(msg);
+
+            if (host == NULL || host[0] == '\0') {
+                return lwcellERR;
+            }
+            AT_PORT_SEND_BEGIN_AT();
+            AT_PORT_SEND_CONST_STR("+CDNSGIP=");
+            lwcelli_send_string(host, 0, 1, 0);
+            AT_PORT_SEND_END_AT();
+            break;
+        }
+#endif /* LWCELL_CFG_DNS */
 #if LWCELL_CFG_USSD
         case LWCELL_CMD_CUSD_GET: {
             AT_PORT_SEND_BEGIN_AT();
@@ -2260,6 +3556,83 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
     return lwcellOK;               /* Valid command */
 }
 
+/**
+ * \brief           Finish send requests merged to send message, that could not be put to producer queue
+ * \param[in]       m: Message that failed
+ * \param[in]       err: Error of type \ref lwcellr_t
+ */
+#if LWCELL_CFG_CONN_TX_COALESCE
+#define CONN_SEND_COALESCE_ABORT(m, err)                                                                               \
+    do {                                                                                                               \
+        if ((m)->cmd_def == LWCELL_CMD_CIPSEND) {                                                                      \
+            (m)->res = (err);                                                                                          \
+            lwcelli_conn_send_coalesce_finish(m);                                                                      \
+        }                                                                                                              \
+    } while (0)
+#else /* LWCELL_CFG_CONN_TX_COALESCE */
+#define CONN_SEND_COALESCE_ABORT(m, err)
+#endif /* !LWCELL_CFG_CONN_TX_COALESCE */
+
+/**
+ * \brief           Abort command in execution when device allows it without breaking the AT flow
+ *
+ * Shared by \ref lwcell_cmd_cancel and \ref lwcell_operator_scan_cancel
+ *
+ * \note            Message must be current message, core must be locked
+ * \param[in]       msg: Current message
+ * \return          `1` if command is aborted, `0` if it cannot be interrupted
+ */
+uint8_t
+lwcelli_cmd_abort(lwcell_msg_t* msg) {
+    switch (CMD_GET_CUR()) {
+        case LWCELL_CMD_COPS_GET_OPT: {
+            if (!msg->msg.cops_scan.cancel) {
+                AT_PORT_SEND_CONST_STR("\r"); /* Any character aborts command in execution */
+                AT_PORT_SEND_FLUSH();
+            }
+            msg->msg.cops_scan.cancel = 1; /* Finishes with entries received so far */
+            return 1;
+        }
+#if LWCELL_CFG_SMS && LWCELL_CFG_CMD_HANDLE
+        case LWCELL_CMD_CMGS: {
+#if LWCELL_CFG_SMS_BULK
+            if (msg->msg.sms_send.bulk != NULL) {
+                return 0;
+            }
+#endif /* LWCELL_CFG_SMS_BULK */
+            if (msg->msg.sms_send.prompt) {
+                return 0; /* Message already handed to device */
+            }
+            msg->cancel = 1; /* Escape is sent on prompt instead of message */
+            return 1;
+        }
+#endif /* LWCELL_CFG_SMS && LWCELL_CFG_CMD_HANDLE */
+        default: return 0;
+    }
+}
+
+/**
+ * \brief           Put urgent message to producer, to be executed before commands waiting in queue
+ * \param[in]       msg: Urgent message
+ * \return          `1` on success, `0` if another urgent message is still waiting
+ */
+static uint8_t
+lwcelli_put_urgent(lwcell_msg_t* msg) {
+    uint8_t ok = 0;
+
+    lwcell_core_lock();
+    if (lwcell.msg_urgent == NULL) {
+        lwcell.msg_urgent = msg;
+        ok = 1;
+    }
+    lwcell_core_unlock();
+    if (ok) {
+        /* Wake producer if it waits on empty queue, otherwise message is taken after current command */
+        lwcell_sys_mbox_putnow(&lwcell.mbox_producer, NULL);
+    }
+    return ok;
+}
+
 /**
  * \brief           Send message from API function to producer queue for further processing
  * \param[in]       msg: New message to process
@@ -2270,6 +3643,9 @@ lwcelli_initiate_cmd(lwcell_msg_t* msg) {
 lwcellr_t
 lwcelli_send_msg_to_producer_mbox(lwcell_msg_t* msg, lwcellr_t (*process_fn)(lwcell_msg_t*), uint32_t max_block_time) {
     lwcellr_t res = msg->res = lwcellOK;
+#if LWCELL_CFG_CMD_HANDLE
+    uint32_t wait_time;
+#endif /* LWCELL_CFG_CMD_HANDLE */
 
     /* Check here if stack is even enabled or shall we disable new command entry? */
     lwcell_core_lock();
@@ -2283,12 +3659,14 @@ lwcelli_send_msg_to_producer_mbox(lwcell_msg_t* msg, lwcellr_t (*process_fn)(lwc
     }
     lwcell_core_unlock();
     if (res != lwcellOK) {
+        CONN_SEND_COALESCE_ABORT(msg, res);
         LWCELL_MSG_VAR_FREE(msg); /* Free memory and return */
         return res;
     }
 
     if (msg->is_blocking) {                         /* In case message is blocking */
         if (!lwcell_sys_sem_create(&msg->sem, 0)) { /* Create semaphore and lock it immediately */
+            CONN_SEND_COALESCE_ABORT(msg, lwcellERRMEM);
             LWCELL_MSG_VAR_FREE(msg);               /* Release memory and return */
             return lwcellERRMEM;
         }
@@ -2298,17 +3676,75 @@ lwcelli_send_msg_to_producer_mbox(lwcell_msg_t* msg, lwcellr_t (*process_fn)(lwc
     }
     msg->block_time = max_block_time;                    /* Set blocking status if necessary */
     msg->fn = process_fn;                                /* Save processing function to be called as callback */
+#if LWCELL_CFG_CMD_HANDLE
+    if (msg->handle != NULL) {
+        if (msg->handle->timeout > 0) {
+            msg->block_time = msg->handle->timeout; /* Deadline overrides default timeout */
+            msg->queue_time = lwcell_sys_now();
+            msg->deadline = 1;
+        }
+        lwcell_core_lock();
+        msg->handle->msg = msg;
+        lwcell_core_unlock();
+    }
+    wait_time = msg->deadline ? msg->block_time : 0;
+#endif /* LWCELL_CFG_CMD_HANDLE */
+#if LWCELL_CFG_PIPE_STATS
+    lwcell_core_lock();
+    msg->queue_time = lwcell_sys_now();
+    if (++lwcell.pipe.queue_depth > lwcell.pipe.queue_depth_max) {
+        lwcell.pipe.queue_depth_max = lwcell.pipe.queue_depth;
+    }
+    lwcell_core_unlock();
+#endif /* LWCELL_CFG_PIPE_STATS */
     if (msg->is_blocking) {
         lwcell_sys_mbox_put(&lwcell.mbox_producer, msg); /* Write message to producer queue and wait forever */
     } else {
-        if (!lwcell_sys_mbox_putnow(&lwcell.mbox_producer, msg)) { /* Write message to producer queue immediately */
+        /* Write message to producer queue immediately */
+        if (msg->urgent ? !lwcelli_put_urgent(msg) : !lwcell_sys_mbox_putnow(&lwcell.mbox_producer, msg)) {
+#if LWCELL_CFG_CMD_HANDLE
+            if (msg->handle != NULL) {
+                lwcell_core_lock();
+                msg->handle->msg = NULL;
+                lwcell_core_unlock();
+            }
+#endif /* LWCELL_CFG_CMD_HANDLE */
+#if LWCELL_CFG_PIPE_STATS
+            lwcell_core_lock();
+            --lwcell.pipe.queue_depth;
+            lwcell_core_unlock();
+#endif /* LWCELL_CFG_PIPE_STATS */
+            CONN_SEND_COALESCE_ABORT(msg, lwcellERRMEM);
             LWCELL_MSG_VAR_FREE(msg);                              /* Release message */
             return lwcellERRMEM;
         }
     }
     if (res == lwcellOK && msg->is_blocking) {    /* In case we have blocking request */
         uint32_t time;
+#if LWCELL_CFG_CMD_HANDLE
+        /* Caller waits for deadline even when command is still queued behind long operation */
+        time = lwcell_sys_sem_wait(&msg->sem, wait_time);
+        lwcell_core_lock();
+        if (msg->detached || (time == LWCELL_SYS_TIMEOUT && !msg->released && msg != lwcell.msg)) {
+            /* Cancelled or deadline passed in queue, producer drops and frees message once it gets to it */
+            res = msg->detached ? lwcellERR : lwcellTIMEOUT;
+            msg->detached = 1;
+            msg->cancel = 1;
+            if (msg->handle != NULL) {
+                msg->handle->msg = NULL;
+                msg->handle = NULL;
+            }
+            lwcell_core_unlock();
+            return res;
+        }
+        lwcell_core_unlock();
+        if (time == LWCELL_SYS_TIMEOUT) {
+            /* Command in execution ends with its own timeout, shortened to remaining deadline */
+            time = lwcell_sys_sem_wait(&msg->sem, 0);
+        }
+#else  /* LWCELL_CFG_CMD_HANDLE */
         time = lwcell_sys_sem_wait(&msg->sem, 0); /* Wait forever for semaphore */
+#endif /* !LWCELL_CFG_CMD_HANDLE */
         if (time == LWCELL_SYS_TIMEOUT) {         /* If semaphore was not accessed within given time */
             res = lwcellTIMEOUT;                  /* Semaphore not released in time */
         } else {
@@ -2363,10 +3799,34 @@ lwcelli_process_events_for_timeout_or_error(lwcell_msg_t* msg, lwcellr_t err) {
             CONN_SEND_DATA_SEND_EVT(msg, err);
             break;
         }
+#if LWCELL_CFG_CONN_MANUAL_RX
+        case LWCELL_CMD_CIPRXGET: {
+            /* Read data error, allow new read to be scheduled */
+            lwcell_pbuf_free_s(&msg->msg.conn_recv.buff);
+            if (msg->msg.conn_recv.conn->val_id == msg->msg.conn_recv.val_id) {
+                msg->msg.conn_recv.conn->status.f.rx_read_queued = 0;
+            }
+            break;
+        }
+#endif /* LWCELL_CFG_CONN_MANUAL_RX */
+#if LWCELL_CFG_CONN_SERVER
+        case LWCELL_CMD_CIPSERVER: {
+            /* Server command failed, status unchanged */
+            lwcelli_send_server_evt(lwcell.m.server_active, msg->msg.tcpip_server.port, err);
+            break;
+        }
+#endif /* LWCELL_CFG_CONN_SERVER */
 #endif /* LWCELL_CFG_CONN */
 
 #if LWCELL_CFG_SMS
         case LWCELL_CMD_CMGS: {
+#if LWCELL_CFG_SMS_BULK
+            if (msg->msg.sms_send.bulk != NULL) {
+                msg->cmd = LWCELL_CMD_IDLE; /* Force job to finish with error */
+                lwcelli_sms_bulk_process(msg, err);
+                break;
+            }
+#endif /* LWCELL_CFG_SMS_BULK */
             /* Send error event */
             SMS_SEND_SEND_EVT(msg, err);
             break;
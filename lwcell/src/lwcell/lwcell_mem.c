@@ -32,18 +32,12 @@
  * Version:         v0.1.1
  */
 #include <limits.h>
+#include <stddef.h>
 #include "lwcell/lwcell_mem.h"
 #include "lwcell/lwcell_private.h"
 
 #if !LWCELL_CFG_MEM_CUSTOM || __DOXYGEN__
 
-#if !__DOXYGEN__
-typedef struct mem_block {
-    struct mem_block* next; /*!< Pointer to next free block */
-    size_t size;            /*!< Size of block */
-} mem_block_t;
-#endif                      /* !__DOXYGEN__ */
-
 /**
  * \brief           Memory alignment bits and absolute number
  */
@@ -51,9 +45,628 @@ typedef struct mem_block {
 #define MEM_ALIGN_NUM            LWCELL_SZ(LWCELL_CFG_MEM_ALIGNMENT)
 #define MEM_ALIGN(x)             LWCELL_MEM_ALIGN(x)
 
+#define MEM_ALLOC_BIT            ((size_t)((size_t)1 << (sizeof(size_t) * CHAR_BIT - 1)))
+
+#if LWCELL_CFG_MEM_STATIC
+
+/*
+ * Static allocation mode.
+ *
+ * Every allocation tag has its own pool of fixed-size entries in statically allocated memory.
+ * Free entries are linked in a list through their first pointer,
+ * hence allocation and free take constant time and there is no heap to fragment.
+ */
+
+/* Size of pool entry, always large enough to hold free list pointer */
+#define MEM_POOL_ENTRY_SIZE(size) MEM_ALIGN(LWCELL_MAX(LWCELL_SZ(size), sizeof(void*)))
+
+#define MEM_POOL_OTHER_SIZE       MEM_POOL_ENTRY_SIZE(LWCELL_CFG_MEM_STATIC_OTHER_SIZE)
+#define MEM_POOL_OTHER_CNT        LWCELL_SZ(LWCELL_CFG_MEM_STATIC_OTHER_CNT)
+#define MEM_POOL_PBUF_SIZE        MEM_POOL_ENTRY_SIZE(LWCELL_CFG_MEM_STATIC_PBUF_SIZE)
+#define MEM_POOL_PBUF_CNT         LWCELL_SZ(LWCELL_CFG_MEM_STATIC_PBUF_CNT)
+#define MEM_POOL_MSG_SIZE         MEM_POOL_ENTRY_SIZE(sizeof(lwcell_msg_t))
+#define MEM_POOL_MSG_CNT          LWCELL_SZ(LWCELL_CFG_MEM_STATIC_MSG_CNT)
+#if LWCELL_CFG_CONN
+#define MEM_POOL_CONN_BUFF_SIZE MEM_POOL_ENTRY_SIZE(LWCELL_CFG_CONN_MAX_DATA_LEN)
+#define MEM_POOL_CONN_BUFF_CNT  LWCELL_SZ(LWCELL_CFG_MEM_STATIC_CONN_BUFF_CNT)
+#else /* LWCELL_CFG_CONN */
+#define MEM_POOL_CONN_BUFF_SIZE LWCELL_SZ(0)
+#define MEM_POOL_CONN_BUFF_CNT  LWCELL_SZ(0)
+#endif /* !LWCELL_CFG_CONN */
+#define MEM_POOL_TIMEOUT_SIZE MEM_POOL_ENTRY_SIZE(sizeof(lwcell_timeout_t))
+#define MEM_POOL_TIMEOUT_CNT  LWCELL_SZ(LWCELL_CFG_MEM_STATIC_TIMEOUT_CNT)
+#if LWCELL_CFG_NETCONN
+#define MEM_POOL_NETCONN_SIZE MEM_POOL_ENTRY_SIZE(sizeof(lwcell_netconn_t))
+#define MEM_POOL_NETCONN_CNT  LWCELL_SZ(LWCELL_CFG_MEM_STATIC_NETCONN_CNT)
+#else /* LWCELL_CFG_NETCONN */
+#define MEM_POOL_NETCONN_SIZE LWCELL_SZ(0)
+#define MEM_POOL_NETCONN_CNT  LWCELL_SZ(0)
+#endif /* !LWCELL_CFG_NETCONN */
+#define MEM_POOL_MQTT_SIZE MEM_POOL_ENTRY_SIZE(LWCELL_CFG_MEM_STATIC_MQTT_SIZE)
+#define MEM_POOL_MQTT_CNT  LWCELL_SZ(LWCELL_CFG_MEM_STATIC_MQTT_CNT)
+
+#define MEM_POOL_BYTES(name) (MEM_POOL_##name##_SIZE * MEM_POOL_##name##_CNT)
+#define MEM_POOLS_BYTES                                                                                                \
+    (MEM_POOL_BYTES(OTHER) + MEM_POOL_BYTES(PBUF) + MEM_POOL_BYTES(MSG) + MEM_POOL_BYTES(CONN_BUFF)                    \
+     + MEM_POOL_BYTES(TIMEOUT) + MEM_POOL_BYTES(NETCONN) + MEM_POOL_BYTES(MQTT))
+#define MEM_POOLS_CNT                                                                                                  \
+    (MEM_POOL_OTHER_CNT + MEM_POOL_PBUF_CNT + MEM_POOL_MSG_CNT + MEM_POOL_CONN_BUFF_CNT + MEM_POOL_TIMEOUT_CNT         \
+     + MEM_POOL_NETCONN_CNT + MEM_POOL_MQTT_CNT)
+#if LWCELL_CFG_PBUF_POOL
+#define MEM_PBUF_POOLS_BYTES LWCELL_SZ(PBUF_POOL_MEM_SIZE)
+#else /* LWCELL_CFG_PBUF_POOL */
+#define MEM_PBUF_POOLS_BYTES LWCELL_SZ(0)
+#endif /* !LWCELL_CFG_PBUF_POOL */
+
+/**
+ * \brief           Static memory footprint of current configuration
+ *
+ * Values are calculated at compile time from `lwcell_opts.h`.
+ * Constant is placed in read-only memory and can be inspected
+ * with debugger or in object file, without running the application.
+ *
+ * \note            Available only when \ref LWCELL_CFG_MEM_STATIC is enabled
+ */
+const lwcell_mem_static_footprint_t lwcell_mem_static_footprint = {
+    /* Entry sizes and counts, in order of lwcell_mem_tag_t */
+    {MEM_POOL_OTHER_SIZE, MEM_POOL_PBUF_SIZE, MEM_POOL_MSG_SIZE, MEM_POOL_CONN_BUFF_SIZE, MEM_POOL_TIMEOUT_SIZE,
+     MEM_POOL_NETCONN_SIZE, MEM_POOL_MQTT_SIZE},
+    {MEM_POOL_OTHER_CNT, MEM_POOL_PBUF_CNT, MEM_POOL_MSG_CNT, MEM_POOL_CONN_BUFF_CNT, MEM_POOL_TIMEOUT_CNT,
+     MEM_POOL_NETCONN_CNT, MEM_POOL_MQTT_CNT},
+    MEM_POOLS_BYTES,
+    MEM_PBUF_POOLS_BYTES,
+    MEM_POOLS_BYTES + MEM_PBUF_POOLS_BYTES,
+};
+
+#if !__DOXYGEN__
+typedef struct {
+    void* free;     /*!< List of free entries */
+    uint8_t* start; /*!< Address of first entry */
+    size_t size;    /*!< Entry size in units of bytes */
+    size_t cnt;     /*!< Number of entries */
+    size_t first;   /*!< Index of first entry in allocated flags array */
+} mem_pool_t;
+#endif /* !__DOXYGEN__ */
+
+/* Memory for all pools, declared as `size_t` array to get aligned start address */
+static size_t mem_pool_mem[(MEM_POOLS_BYTES + sizeof(size_t) - 1) / sizeof(size_t) + 1];
+static uint8_t mem_pool_used[MEM_POOLS_CNT + 1]; /*!< Allocated flag of each entry, to ignore invalid free */
+static mem_pool_t mem_pools[LWCELL_MEM_TAG_END]; /*!< Pools, indexed by allocation tag */
+static uint8_t mem_pools_ready;                  /*!< Set to `1` when pools are initialized */
+static size_t mem_available_bytes;               /*!< Number of bytes in free entries */
+
+#define MEM_BLOCK_USER_SIZE(ptr) mem_pool_entry_size(ptr)
+
+/**
+ * \brief           Split pool memory to entries and link them to free lists
+ */
+static void
+mem_pool_init(void) {
+    uint8_t* mem = (uint8_t*)mem_pool_mem;
+    size_t first = 0;
+
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(mem_pools); ++i) {
+        mem_pool_t* pool = &mem_pools[i];
+
+        pool->size = lwcell_mem_static_footprint.entry_size[i];
+        pool->cnt = lwcell_mem_static_footprint.entry_cnt[i];
+        pool->start = mem;
+        pool->first = first;
+        pool->free = NULL;
+
+        /* Link from the last entry, so that entries are taken in address order */
+        for (size_t j = pool->cnt; j > 0; --j) {
+            void** entry = (void*)(mem + (j - 1) * pool->size);
+
+            *entry = pool->free;
+            pool->free = entry;
+        }
+        mem += pool->size * pool->cnt;
+        first += pool->cnt;
+        mem_available_bytes += pool->size * pool->cnt;
+    }
+    mem_pools_ready = 1;
+    LWCELL_DEBUGF(LWCELL_CFG_DBG_MEM | LWCELL_DBG_TYPE_TRACE,
+                  "[LWCELL MEM] Static pools: %d bytes, packet buffer pools: %d bytes\r\n",
+                  (int)lwcell_mem_static_footprint.pools_bytes, (int)lwcell_mem_static_footprint.pbuf_pools_bytes);
+}
+
+/**
+ * \brief           Find pool and entry index for memory address
+ * \param[in]       ptr: Entry address
+ * \param[out]      idx: Index of entry in allocated flags array
+ * \return          Pool entry belongs to, `NULL` if address is not start of pool entry
+ */
+static mem_pool_t*
+mem_pool_find(const void* ptr, size_t* idx) {
+    const uint8_t* p = ptr;
+
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(mem_pools); ++i) {
+        mem_pool_t* pool = &mem_pools[i];
+
+        if (pool->cnt > 0 && p >= pool->start && p < (pool->start + pool->size * pool->cnt)
+            && ((size_t)(p - pool->start) % pool->size) == 0) {
+            *idx = pool->first + (size_t)(p - pool->start) / pool->size;
+            return pool;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Get entry size for memory address
+ * \param[in]       ptr: Entry address
+ * \return          Entry size in units of bytes, `0` if address is not pool entry
+ */
+static size_t
+mem_pool_entry_size(const void* ptr) {
+    mem_pool_t* pool;
+    size_t idx;
+
+    pool = mem_pool_find(ptr, &idx);
+    return pool != NULL ? pool->size : 0;
+}
+
+/**
+ * \brief           Initialize pools. Regions are not used in static allocation mode
+ * \param[in]       regions: Not used
+ * \param[in]       len: Not used
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+mem_assignmem(const lwcell_mem_region_t* regions, size_t len) {
+    LWCELL_UNUSED(regions);
+    LWCELL_UNUSED(len);
+    if (!mem_pools_ready) {
+        mem_pool_init();
+    }
+    return 1;
+}
+
+/**
+ * \brief           Take entry from pool of allocation tag
+ * \param[in]       size: Number of bytes to allocate
+ * \param[in]       tag: Allocation tag
+ * \return          Memory address on success, `NULL` if pool is exhausted or entry is too small
+ */
+static void*
+mem_pool_alloc(size_t size, lwcell_mem_tag_t tag) {
+    mem_pool_t* pool;
+    void** entry;
+
+    if (!mem_pools_ready) {
+        mem_pool_init();
+    }
+    pool = &mem_pools[tag];
+    if (size == 0 || size > pool->size || pool->free == NULL) {
+        return NULL;
+    }
+    entry = pool->free;
+    pool->free = *entry;
+    mem_pool_used[pool->first + ((uint8_t*)entry - pool->start) / pool->size] = 1;
+    mem_available_bytes -= pool->size;
+    return entry;
+}
+
+/**
+ * \brief           Return entry back to its pool
+ * \param[in]       ptr: Entry address
+ */
+static void
+mem_pool_free(void* ptr) {
+    mem_pool_t* pool;
+    size_t idx;
+
+    if (ptr == NULL || (pool = mem_pool_find(ptr, &idx)) == NULL || !mem_pool_used[idx]) {
+        return;
+    }
+    mem_pool_used[idx] = 0;
+    *(void**)ptr = pool->free;
+    pool->free = ptr;
+    mem_available_bytes += pool->size;
+}
+
+#if LWCELL_CFG_MEM_STATS
+
+#define MEM_BLOCK_BYTES(ptr)        mem_pool_entry_size(ptr)
+#define MEM_BLOCK_IS_ALLOC(ptr)     mem_pool_is_alloc(ptr)
+#define MEM_BLOCK_GET_TAG(ptr)      mem_pool_get_tag(ptr)
+#define MEM_BLOCK_SET_TAG(ptr, tag) LWCELL_UNUSED(tag)
+
+/**
+ * \brief           Check if memory address is allocated pool entry
+ * \param[in]       ptr: Entry address
+ * \return          `1` if allocated, `0` otherwise
+ */
+static uint8_t
+mem_pool_is_alloc(const void* ptr) {
+    size_t idx;
+    return mem_pool_find(ptr, &idx) != NULL && mem_pool_used[idx];
+}
+
+/**
+ * \brief           Get allocation tag of pool entry
+ * \param[in]       ptr: Allocated entry address
+ * \return          Allocation tag
+ */
+static size_t
+mem_pool_get_tag(const void* ptr) {
+    size_t idx;
+    return (size_t)(mem_pool_find(ptr, &idx) - mem_pools);
+}
+
+/**
+ * \brief           Get size of largest free entry available to user
+ * \return          Largest number of bytes single allocation can currently get
+ */
+static size_t
+mem_get_largest_free(void) {
+    size_t max = 0;
+
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(mem_pools); ++i) {
+        if (mem_pools[i].free != NULL) {
+            max = LWCELL_MAX(max, mem_pools[i].size);
+        }
+    }
+    return max;
+}
+
+#endif /* LWCELL_CFG_MEM_STATS */
+
+#elif LWCELL_CFG_MEM_TLSF
+
+/*
+ * Two-level segregated fit allocator.
+ *
+ * Free blocks are kept in segregated lists, indexed by first level (power of 2 range)
+ * and second level (linear subdivision of the range). Bitmaps of non-empty lists
+ * allow to find suitable block with few bit-scan operations, independent on number
+ * of free blocks and fragmentation. Freed blocks are merged with physical neighbours immediately.
+ */
+
+#if !__DOXYGEN__
+typedef struct mem_block {
+    struct mem_block* prev_phys; /*!< Physically previous block in region, `NULL` for first block */
+    size_t size;                 /*!< Size of block including header. Upper bit set when allocated */
+#if LWCELL_CFG_MEM_STATS
+    uint8_t tag; /*!< Allocation tag of allocated block */
+#endif           /* LWCELL_CFG_MEM_STATS */
+    struct mem_block* next_free; /*!< Next free block in segregated list. Valid only when block is free */
+    struct mem_block* prev_free; /*!< Previous free block in segregated list. Valid only when block is free */
+} mem_block_t;
+#endif /* !__DOXYGEN__ */
+
+#define TLSF_SL_LOG2             3                             /*!< Log2 of second level lists per first level */
+#define TLSF_SL_COUNT            (1U << TLSF_SL_LOG2)          /*!< Number of second level lists */
+#define TLSF_FL_SHIFT            (TLSF_SL_LOG2 + 2)            /*!< Blocks below `2^shift` are in first level `0` */
+#define TLSF_FL_COUNT            20                            /*!< Number of first level lists */
+#define TLSF_SMALL_SIZE          (LWCELL_SZ(1) << TLSF_FL_SHIFT)
+#define TLSF_MAX_SIZE            (LWCELL_SZ(1) << (TLSF_FL_COUNT + TLSF_FL_SHIFT - 1))
+
+#define MEMBLOCK_METASIZE        MEM_ALIGN(offsetof(mem_block_t, next_free))
+#define MEMBLOCK_MIN_SIZE        MEM_ALIGN(sizeof(mem_block_t))
+#define MEM_BLOCK_SIZE(b)        ((b)->size & ~MEM_ALLOC_BIT)
+#define MEM_BLOCK_NEXT_PHYS(b)   ((mem_block_t*)((uint8_t*)(b) + MEM_BLOCK_SIZE(b)))
+#define MEM_BLOCK_FROM_PTR(ptr)  ((mem_block_t*)(((uint8_t*)(ptr)) - MEMBLOCK_METASIZE))
+#define MEM_BLOCK_USER_SIZE(ptr) (MEM_BLOCK_SIZE(MEM_BLOCK_FROM_PTR(ptr)) - MEMBLOCK_METASIZE)
+
+static mem_block_t* mem_lists[TLSF_FL_COUNT][TLSF_SL_COUNT]; /*!< Heads of segregated free lists */
+static uint32_t mem_sl_bitmap[TLSF_FL_COUNT];                 /*!< Non-empty second level lists */
+static uint32_t mem_fl_bitmap;                                /*!< First levels with non-empty second level list */
+static uint8_t mem_initialized;                               /*!< Set to `1` when regions are assigned */
+static size_t mem_available_bytes;                            /*!< Number of available bytes for allocations */
+
+/**
+ * \brief           Get position of least significant set bit
+ * \param[in]       x: Value to scan, must not be `0`
+ * \return          Bit position
+ */
+static uint32_t
+mem_ffs(uint32_t x) {
+#if defined(__GNUC__)
+    return (uint32_t)__builtin_ctzl((unsigned long)x);
+#else  /* defined(__GNUC__) */
+    uint32_t pos = 0;
+    for (; !(x & 0x01); x >>= 1, ++pos) {}
+    return pos;
+#endif /* !defined(__GNUC__) */
+}
+
+/**
+ * \brief           Get position of most significant set bit
+ * \param[in]       x: Value to scan, must not be `0`
+ * \return          Bit position
+ */
+static uint32_t
+mem_fls(size_t x) {
+#if defined(__GNUC__)
+    return (uint32_t)(sizeof(unsigned long long) * CHAR_BIT - 1 - __builtin_clzll((unsigned long long)x));
+#else  /* defined(__GNUC__) */
+    uint32_t pos = 0;
+    for (; x > 1; x >>= 1, ++pos) {}
+    return pos;
+#endif /* !defined(__GNUC__) */
+}
+
+/**
+ * \brief           Get first and second level list indexes for block size
+ * \param[in]       size: Block size in units of bytes
+ * \param[out]      fl: First level index
+ * \param[out]      sl: Second level index
+ */
+static void
+mem_mapping(size_t size, uint32_t* fl, uint32_t* sl) {
+    uint32_t bit;
+
+    if (size < TLSF_SMALL_SIZE) {
+        *fl = 0;
+        *sl = (uint32_t)(size / (TLSF_SMALL_SIZE / TLSF_SL_COUNT));
+    } else {
+        bit = mem_fls(size);
+        *sl = (uint32_t)(size >> (bit - TLSF_SL_LOG2)) ^ TLSF_SL_COUNT;
+        *fl = bit - TLSF_FL_SHIFT + 1;
+    }
+}
+
+/**
+ * \brief           Remove free block from its segregated list
+ * \param[in]       b: Free block to remove
+ */
+static void
+mem_remove_free(mem_block_t* b) {
+    uint32_t fl, sl;
+
+    mem_mapping(b->size, &fl, &sl);
+    if (b->next_free != NULL) {
+        b->next_free->prev_free = b->prev_free;
+    }
+    if (b->prev_free != NULL) {
+        b->prev_free->next_free = b->next_free;
+    } else {
+        mem_lists[fl][sl] = b->next_free; /* Block was list head */
+        if (mem_lists[fl][sl] == NULL) {
+            mem_sl_bitmap[fl] &= ~(1UL << sl);
+            if (mem_sl_bitmap[fl] == 0) {
+                mem_fl_bitmap &= ~(1UL << fl);
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Insert free block to head of its segregated list
+ * \param[in]       b: Free block with known size
+ */
+static void
+mem_insert_free(mem_block_t* b) {
+    uint32_t fl, sl;
+
+    mem_mapping(b->size, &fl, &sl);
+    b->prev_free = NULL;
+    b->next_free = mem_lists[fl][sl];
+    if (b->next_free != NULL) {
+        b->next_free->prev_free = b;
+    }
+    mem_lists[fl][sl] = b;
+    mem_sl_bitmap[fl] |= 1UL << sl;
+    mem_fl_bitmap |= 1UL << fl;
+}
+
+/**
+ * \brief           Assign memory for HEAP allocations
+ * \param[in]       regions: Pointer to list of regions.
+ *                  Set regions in ascending order by address
+ * \param[in]       len: Number of regions to assign
+ */
+static uint8_t
+mem_assignmem(const lwcell_mem_region_t* regions, size_t len) {
+    uint8_t* mem_start_addr;
+    size_t mem_size;
+    mem_block_t *first_block, *end_block;
+
+    if (mem_initialized) { /* Regions already defined */
+        return 0;
+    }
+
+    /* Check if region address are linear and rising */
+    mem_start_addr = (uint8_t*)0;
+    for (size_t i = 0; i < len; ++i) {
+        if (mem_start_addr >= (uint8_t*)regions[i].start_addr) { /* Check if previous greater than current */
+            return 0;                                            /* Return as invalid and failed */
+        }
+        mem_start_addr = (uint8_t*)regions[i].start_addr;        /* Save as previous address */
+    }
+
+    for (; len > 0; --len, ++regions) {
+        /* Get aligned start address and size */
+        mem_size = regions->size;
+        mem_start_addr = (uint8_t*)regions->start_addr;
+        if (LWCELL_SZ(mem_start_addr) & MEM_ALIGN_BITS) {
+            if (mem_size < MEM_ALIGN_NUM) {
+                continue;
+            }
+            mem_start_addr += MEM_ALIGN_NUM - (LWCELL_SZ(mem_start_addr) & MEM_ALIGN_BITS);
+            mem_size -= mem_start_addr - (uint8_t*)regions->start_addr;
+        }
+        mem_size &= ~MEM_ALIGN_BITS;
+
+        /* Limit region to largest block first level lists can hold, including end block */
+        if (mem_size > (TLSF_MAX_SIZE - MEM_ALIGN_NUM + MEMBLOCK_METASIZE)) {
+            mem_size = TLSF_MAX_SIZE - MEM_ALIGN_NUM + MEMBLOCK_METASIZE;
+        }
+        if (mem_size < (MEMBLOCK_MIN_SIZE + MEMBLOCK_METASIZE)) {
+            continue;
+        }
+
+        /*
+         * Region consists of one free block and end block.
+         * End block is marked as allocated, to never be merged with
+         */
+        first_block = (mem_block_t*)mem_start_addr;
+        first_block->prev_phys = NULL;
+        first_block->size = mem_size - MEMBLOCK_METASIZE;
+
+        end_block = MEM_BLOCK_NEXT_PHYS(first_block);
+        end_block->prev_phys = first_block;
+        end_block->size = MEM_ALLOC_BIT;
+
+        mem_insert_free(first_block);
+        mem_available_bytes += first_block->size;
+        mem_initialized = 1;
+    }
+
+    return mem_initialized; /* Regions set as expected */
+}
+
+/**
+ * \brief           Allocate memory of specific size
+ * \param[in]       size: Number of bytes to allocate
+ * \return          Memory address on success, `NULL` otherwise
+ */
+static void*
+mem_alloc(size_t size) {
+    mem_block_t *b, *next;
+    uint32_t fl, sl;
+    size_t map, search_size;
+
+    if (!mem_initialized || size == 0 || size >= TLSF_MAX_SIZE) {
+        return NULL;
+    }
+
+    size = MEM_ALIGN(size) + MEMBLOCK_METASIZE; /* Increase size for metadata */
+    if (size < MEMBLOCK_MIN_SIZE) {
+        size = MEMBLOCK_MIN_SIZE;
+    }
+    if (size > mem_available_bytes) { /* Check if we have enough memory available */
+        return NULL;
+    }
+
+    /*
+     * Round size up to next list boundary,
+     * so that any block in found list is large enough
+     */
+    search_size = size;
+    if (search_size >= TLSF_SMALL_SIZE) {
+        search_size += (LWCELL_SZ(1) << (mem_fls(search_size) - TLSF_SL_LOG2)) - 1;
+    }
+    mem_mapping(search_size, &fl, &sl);
+
+    /* Find non-empty list in the same first level, or any larger first level */
+    b = NULL;
+    map = fl < TLSF_FL_COUNT ? (mem_sl_bitmap[fl] & (~0UL << sl)) : 0;
+    if (map == 0 && fl + 1 < TLSF_FL_COUNT) {
+        map = mem_fl_bitmap & (~0UL << (fl + 1));
+        if (map != 0) {
+            fl = mem_ffs((uint32_t)map);
+            map = mem_sl_bitmap[fl];
+        }
+    }
+    if (map != 0) {
+        sl = mem_ffs((uint32_t)map);
+        b = mem_lists[fl][sl];
+    } else {
+        /*
+         * Rounded size does not fit any list.
+         * As last resort, check list exact size belongs to,
+         * where some blocks may still be large enough
+         */
+        mem_mapping(size, &fl, &sl);
+        for (b = fl < TLSF_FL_COUNT ? mem_lists[fl][sl] : NULL; b != NULL && b->size < size; b = b->next_free) {}
+        if (b == NULL) {
+            return NULL; /* Allocation failed, no free blocks of required size */
+        }
+    }
+    mem_remove_free(b);
+
+    /* Split block when remaining part is large enough to hold new block */
+    if (b->size - size >= MEMBLOCK_MIN_SIZE) {
+        next = (mem_block_t*)((uint8_t*)b + size);
+        next->size = b->size - size;
+        next->prev_phys = b;
+        MEM_BLOCK_NEXT_PHYS(next)->prev_phys = next;
+        b->size = size;
+        mem_insert_free(next);
+    }
+    mem_available_bytes -= b->size; /* Decrease available memory */
+    b->size |= MEM_ALLOC_BIT;       /* Set allocated bit = memory is allocated */
+    return (uint8_t*)b + MEMBLOCK_METASIZE;
+}
+
+/**
+ * \brief           Free memory
+ * \param[in]       ptr: Pointer to memory previously returned using \ref lwcell_mem_malloc,
+ *                      \ref lwcell_mem_calloc or \ref lwcell_mem_realloc functions
+ */
+static void
+mem_free(void* ptr) {
+    mem_block_t *b, *n;
+
+    if (ptr == NULL) { /* To be in compliance with C free function */
+        return;
+    }
+
+    b = MEM_BLOCK_FROM_PTR(ptr);
+    if (!(b->size & MEM_ALLOC_BIT)) { /* Block must be allocated */
+        return;
+    }
+    b->size &= ~MEM_ALLOC_BIT;
+    mem_available_bytes += b->size;
+
+    /* Merge with next and previous physical blocks if they are free */
+    n = MEM_BLOCK_NEXT_PHYS(b);
+    if (!(n->size & MEM_ALLOC_BIT)) {
+        mem_remove_free(n);
+        b->size += n->size;
+    }
+    if (b->prev_phys != NULL && !(b->prev_phys->size & MEM_ALLOC_BIT)) {
+        mem_remove_free(b->prev_phys);
+        b->prev_phys->size += b->size;
+        b = b->prev_phys;
+    }
+    MEM_BLOCK_NEXT_PHYS(b)->prev_phys = b;
+    mem_insert_free(b);
+}
+
+#if LWCELL_CFG_MEM_STATS
+
+/**
+ * \brief           Get size of largest free block available to user
+ * \return          Largest number of bytes single allocation can currently get
+ */
+static size_t
+mem_get_largest_free(void) {
+    size_t max = 0;
+    uint32_t fl, sl;
+
+    if (mem_fl_bitmap == 0) {
+        return 0;
+    }
+
+    /* Largest block is in highest non-empty list */
+    fl = mem_fls(mem_fl_bitmap);
+    sl = mem_fls(mem_sl_bitmap[fl]);
+    for (mem_block_t* b = mem_lists[fl][sl]; b != NULL; b = b->next_free) {
+        max = LWCELL_MAX(max, b->size);
+    }
+    return max - MEMBLOCK_METASIZE;
+}
+
+#endif /* LWCELL_CFG_MEM_STATS */
+
+#else /* LWCELL_CFG_MEM_STATIC */
+
+#if !__DOXYGEN__
+typedef struct mem_block {
+    struct mem_block* next; /*!< Pointer to next free block */
+    size_t size;            /*!< Size of block */
+#if LWCELL_CFG_MEM_STATS
+    uint8_t tag; /*!< Allocation tag of allocated block */
+#endif           /* LWCELL_CFG_MEM_STATS */
+} mem_block_t;
+#endif                      /* !__DOXYGEN__ */
+
 #define MEMBLOCK_METASIZE        MEM_ALIGN(sizeof(mem_block_t))
 
-#define MEM_ALLOC_BIT            ((size_t)((size_t)1 << (sizeof(size_t) * CHAR_BIT - 1)))
 #define MEM_BLOCK_FROM_PTR(ptr)  ((mem_block_t*)(((uint8_t*)(ptr)) - MEMBLOCK_METASIZE))
 #define MEM_BLOCK_USER_SIZE(ptr) ((MEM_BLOCK_FROM_PTR(ptr)->size & ~MEM_ALLOC_BIT) - MEMBLOCK_METASIZE)
 
@@ -310,18 +923,107 @@ mem_free(void* ptr) {
     }
 }
 
+#if LWCELL_CFG_MEM_STATS
+
+/**
+ * \brief           Get size of largest free block available to user
+ * \return          Largest number of bytes single allocation can currently get
+ */
+static size_t
+mem_get_largest_free(void) {
+    size_t max = 0;
+
+    for (mem_block_t* b = start_block.next; b != NULL && b != end_block; b = b->next) {
+        max = LWCELL_MAX(max, b->size);
+    }
+    return max > MEMBLOCK_METASIZE ? (max - MEMBLOCK_METASIZE) : 0;
+}
+
+#endif /* LWCELL_CFG_MEM_STATS */
+
+#endif /* !LWCELL_CFG_MEM_STATIC */
+
+#if LWCELL_CFG_MEM_STATS && !LWCELL_CFG_MEM_STATIC
+#define MEM_BLOCK_BYTES(ptr)        (MEM_BLOCK_USER_SIZE(ptr) + MEMBLOCK_METASIZE)
+#define MEM_BLOCK_IS_ALLOC(ptr)     (MEM_BLOCK_FROM_PTR(ptr)->size & MEM_ALLOC_BIT)
+#define MEM_BLOCK_GET_TAG(ptr)      (MEM_BLOCK_FROM_PTR(ptr)->tag)
+#define MEM_BLOCK_SET_TAG(ptr, tag) (MEM_BLOCK_FROM_PTR(ptr)->tag = (uint8_t)(tag))
+#endif /* LWCELL_CFG_MEM_STATS && !LWCELL_CFG_MEM_STATIC */
+
+#if LWCELL_CFG_MEM_STATS
+static lwcell_mem_stats_t mem_stats; /*!< Memory statistics. Free bytes are calculated when read */
+#endif                               /* LWCELL_CFG_MEM_STATS */
+
+/**
+ * \brief           Allocate memory block and account it to tag
+ * \param[in]       size: Number of bytes to allocate
+ * \param[in]       tag: Allocation tag
+ * \return          Memory address on success, `NULL` otherwise
+ */
+static void*
+mem_alloc_tag(size_t size, lwcell_mem_tag_t tag) {
+    void* ptr;
+
+    if (tag >= LWCELL_MEM_TAG_END) {
+        tag = LWCELL_MEM_TAG_OTHER;
+    }
+#if LWCELL_CFG_MEM_STATIC
+    ptr = mem_pool_alloc(size, tag);
+#else  /* LWCELL_CFG_MEM_STATIC */
+    ptr = mem_alloc(size);
+#endif /* !LWCELL_CFG_MEM_STATIC */
+#if LWCELL_CFG_MEM_STATS
+    if (ptr != NULL) {
+        lwcell_mem_tag_stats_t* s = &mem_stats.tags[tag];
+        size_t bytes = MEM_BLOCK_BYTES(ptr);
+
+        MEM_BLOCK_SET_TAG(ptr, tag);
+        s->cur_bytes += bytes;
+        s->peak_bytes = LWCELL_MAX(s->peak_bytes, s->cur_bytes);
+        ++s->alloc_cnt;
+        mem_stats.used_bytes += bytes;
+        mem_stats.peak_used_bytes = LWCELL_MAX(mem_stats.peak_used_bytes, mem_stats.used_bytes);
+    } else if (size > 0) {
+        ++mem_stats.tags[tag].fail_cnt;
+    }
+#endif /* LWCELL_CFG_MEM_STATS */
+    return ptr;
+}
+
+/**
+ * \brief           Free memory block and remove it from tag accounting
+ * \param[in]       ptr: Pointer to allocated memory
+ */
+static void
+mem_free_tag(void* ptr) {
+#if LWCELL_CFG_MEM_STATS
+    if (ptr != NULL && MEM_BLOCK_IS_ALLOC(ptr)) {
+        size_t bytes = MEM_BLOCK_BYTES(ptr);
+
+        mem_stats.tags[MEM_BLOCK_GET_TAG(ptr)].cur_bytes -= bytes;
+        mem_stats.used_bytes -= bytes;
+    }
+#endif /* LWCELL_CFG_MEM_STATS */
+#if LWCELL_CFG_MEM_STATIC
+    mem_pool_free(ptr);
+#else  /* LWCELL_CFG_MEM_STATIC */
+    mem_free(ptr);
+#endif /* !LWCELL_CFG_MEM_STATIC */
+}
+
 /**
  * \brief           Allocate memory of specific size
  * \param[in]       num: Number of elements to allocate
  * \param[in]       size: Size of element in units of bytes
+ * \param[in]       tag: Allocation tag
  * \return          Memory address on success, `NULL` otherwise
  */
 static void*
-mem_calloc(size_t num, size_t size) {
+mem_calloc(size_t num, size_t size, lwcell_mem_tag_t tag) {
     void* ptr;
     size_t tot_len = num * size;
 
-    if ((ptr = mem_alloc(tot_len)) != NULL) { /* Try to allocate memory */
+    if ((ptr = mem_alloc_tag(tot_len, tag)) != NULL) { /* Try to allocate memory */
         LWCELL_MEMSET(ptr, 0x00, tot_len);    /* Reset entire memory */
     }
     return ptr;
@@ -333,37 +1035,38 @@ mem_calloc(size_t num, size_t size) {
  * \param[in]       ptr: Pointer to current allocated memory to resize, returned using
  *                      \ref lwcell_mem_malloc, \ref lwcell_mem_calloc or \ref lwcell_mem_realloc functions
  * \param[in]       size: Number of bytes to allocate on new memory
+ * \param[in]       tag: Allocation tag
  * \return          Memory address on success, `NULL` otherwise
  */
 static void*
-mem_realloc(void* ptr, size_t size) {
+mem_realloc(void* ptr, size_t size, lwcell_mem_tag_t tag) {
     void* new_ptr;
     size_t old_size;
 
-    if (ptr == NULL) {          /* If pointer is not valid */
-        return mem_alloc(size); /* Only allocate memory */
+    if (ptr == NULL) {                   /* If pointer is not valid */
+        return mem_alloc_tag(size, tag); /* Only allocate memory */
     }
 
     old_size = MEM_BLOCK_USER_SIZE(ptr);                         /* Get size of old pointer */
-    new_ptr = mem_alloc(size);                                   /* Try to allocate new memory block */
+    new_ptr = mem_alloc_tag(size, tag);                          /* Try to allocate new memory block */
     if (new_ptr != NULL) {
         LWCELL_MEMCPY(new_ptr, ptr, LWCELL_MIN(size, old_size)); /* Copy old data to new array */
-        mem_free(ptr);                                           /* Free old pointer */
+        mem_free_tag(ptr);                                       /* Free old pointer */
     }
     return new_ptr;
 }
 
 /**
- * \brief           Allocate memory of specific size
+ * \brief           Allocate memory under core lock
  * \param[in]       size: Number of bytes to allocate
+ * \param[in]       tag: Allocation tag
  * \return          Memory address on success, `NULL` otherwise
- * \note            Function is not available when \ref LWCELL_CFG_MEM_CUSTOM is `1` and must be implemented by user
  */
-void*
-lwcell_mem_malloc(size_t size) {
+static void*
+mem_malloc_locked(size_t size, lwcell_mem_tag_t tag) {
     void* ptr;
     lwcell_core_lock();
-    ptr = mem_calloc(1, size); /* Allocate memory and return pointer */
+    ptr = mem_calloc(1, size, tag); /* Allocate memory and return pointer */
     lwcell_core_unlock();
     LWCELL_DEBUGW(LWCELL_CFG_DBG_MEM | LWCELL_DBG_TYPE_TRACE, ptr == NULL,
                   "[LWCELL MEM] Allocation failed: %d bytes\r\n", (int)size);
@@ -373,18 +1076,16 @@ lwcell_mem_malloc(size_t size) {
 }
 
 /**
- * \brief           Reallocate memory to specific size
- * \note            After new memory is allocated, content of old one is copied to new memory
- * \param[in]       ptr: Pointer to current allocated memory to resize, returned using \ref lwcell_mem_malloc,
- *                      \ref lwcell_mem_calloc or \ref lwcell_mem_realloc functions
+ * \brief           Reallocate memory under core lock
+ * \param[in]       ptr: Pointer to current allocated memory to resize
  * \param[in]       size: Number of bytes to allocate on new memory
+ * \param[in]       tag: Allocation tag
  * \return          Memory address on success, `NULL` otherwise
- * \note            Function is not available when \ref LWCELL_CFG_MEM_CUSTOM is `1` and must be implemented by user
  */
-void*
-lwcell_mem_realloc(void* ptr, size_t size) {
+static void*
+mem_realloc_locked(void* ptr, size_t size, lwcell_mem_tag_t tag) {
     lwcell_core_lock();
-    ptr = mem_realloc(ptr, size); /* Reallocate and return pointer */
+    ptr = mem_realloc(ptr, size, tag); /* Reallocate and return pointer */
     lwcell_core_unlock();
     LWCELL_DEBUGW(LWCELL_CFG_DBG_MEM | LWCELL_DBG_TYPE_TRACE, ptr == NULL,
                   "[LWCELL MEM] Reallocation failed: %d bytes\r\n", (int)size);
@@ -394,17 +1095,17 @@ lwcell_mem_realloc(void* ptr, size_t size) {
 }
 
 /**
- * \brief           Allocate memory of specific size and set memory to zero
+ * \brief           Allocate memory and set it to zero under core lock
  * \param[in]       num: Number of elements to allocate
  * \param[in]       size: Size of each element
+ * \param[in]       tag: Allocation tag
  * \return          Memory address on success, `NULL` otherwise
- * \note            Function is not available when \ref LWCELL_CFG_MEM_CUSTOM is `1` and must be implemented by user
  */
-void*
-lwcell_mem_calloc(size_t num, size_t size) {
+static void*
+mem_calloc_locked(size_t num, size_t size, lwcell_mem_tag_t tag) {
     void* ptr;
     lwcell_core_lock();
-    ptr = mem_calloc(num, size); /* Allocate memory and clear it to 0. Then return pointer */
+    ptr = mem_calloc(num, size, tag); /* Allocate memory and clear it to 0. Then return pointer */
     lwcell_core_unlock();
     LWCELL_DEBUGW(LWCELL_CFG_DBG_MEM | LWCELL_DBG_TYPE_TRACE, ptr == NULL,
                   "[LWCELL MEM] Callocation failed: %d bytes\r\n", (int)size * (int)num);
@@ -413,6 +1114,43 @@ lwcell_mem_calloc(size_t num, size_t size) {
     return ptr;
 }
 
+/**
+ * \brief           Allocate memory of specific size
+ * \param[in]       size: Number of bytes to allocate
+ * \return          Memory address on success, `NULL` otherwise
+ * \note            Function is not available when \ref LWCELL_CFG_MEM_CUSTOM is `1` and must be implemented by user
+ */
+void*
+lwcell_mem_malloc(size_t size) {
+    return mem_malloc_locked(size, LWCELL_MEM_TAG_OTHER);
+}
+
+/**
+ * \brief           Reallocate memory to specific size
+ * \note            After new memory is allocated, content of old one is copied to new memory
+ * \param[in]       ptr: Pointer to current allocated memory to resize, returned using \ref lwcell_mem_malloc,
+ *                      \ref lwcell_mem_calloc or \ref lwcell_mem_realloc functions
+ * \param[in]       size: Number of bytes to allocate on new memory
+ * \return          Memory address on success, `NULL` otherwise
+ * \note            Function is not available when \ref LWCELL_CFG_MEM_CUSTOM is `1` and must be implemented by user
+ */
+void*
+lwcell_mem_realloc(void* ptr, size_t size) {
+    return mem_realloc_locked(ptr, size, LWCELL_MEM_TAG_OTHER);
+}
+
+/**
+ * \brief           Allocate memory of specific size and set memory to zero
+ * \param[in]       num: Number of elements to allocate
+ * \param[in]       size: Size of each element
+ * \return          Memory address on success, `NULL` otherwise
+ * \note            Function is not available when \ref LWCELL_CFG_MEM_CUSTOM is `1` and must be implemented by user
+ */
+void*
+lwcell_mem_calloc(size_t num, size_t size) {
+    return mem_calloc_locked(num, size, LWCELL_MEM_TAG_OTHER);
+}
+
 /**
  * \brief           Free memory
  * \param[in]       ptr: Pointer to memory previously returned using \ref lwcell_mem_malloc,
@@ -427,7 +1165,7 @@ lwcell_mem_free(void* ptr) {
     LWCELL_DEBUGF(LWCELL_CFG_DBG_MEM | LWCELL_DBG_TYPE_TRACE, "[LWCELL MEM] Free size: %d, address: %p\r\n",
                   (int)MEM_BLOCK_USER_SIZE(ptr), ptr);
     lwcell_core_lock();
-    mem_free(ptr);
+    mem_free_tag(ptr);
     lwcell_core_unlock();
 }
 
@@ -438,6 +1176,8 @@ lwcell_mem_free(void* ptr) {
  * \param[in]       len: Number of regions to use
  * \return          `1` on success, `0` otherwise
  * \note            Function is not available when \ref LWCELL_CFG_MEM_CUSTOM is `1`
+ * \note            When \ref LWCELL_CFG_MEM_STATIC is enabled, regions are ignored and
+ *                  function only initializes static pools
  */
 uint8_t
 lwcell_mem_assignmemory(const lwcell_mem_region_t* regions, size_t len) {
@@ -446,6 +1186,86 @@ lwcell_mem_assignmemory(const lwcell_mem_region_t* regions, size_t len) {
     return ret;
 }
 
+#if LWCELL_CFG_MEM_STATS || LWCELL_CFG_MEM_STATIC || __DOXYGEN__
+
+/**
+ * \brief           Allocate memory of specific size and account it to allocation tag
+ * \param[in]       size: Number of bytes to allocate
+ * \param[in]       tag: Allocation tag, member of \ref lwcell_mem_tag_t
+ * \return          Memory address on success, `NULL` otherwise
+ * \sa              LWCELL_MEM_MALLOC
+ */
+void*
+lwcell_mem_malloc_tag(size_t size, lwcell_mem_tag_t tag) {
+    return mem_malloc_locked(size, tag);
+}
+
+/**
+ * \brief           Reallocate memory to specific size and account it to allocation tag
+ * \param[in]       ptr: Pointer to current allocated memory to resize
+ * \param[in]       size: Number of bytes to allocate on new memory
+ * \param[in]       tag: Allocation tag, member of \ref lwcell_mem_tag_t
+ * \return          Memory address on success, `NULL` otherwise
+ * \sa              LWCELL_MEM_REALLOC
+ */
+void*
+lwcell_mem_realloc_tag(void* ptr, size_t size, lwcell_mem_tag_t tag) {
+    return mem_realloc_locked(ptr, size, tag);
+}
+
+/**
+ * \brief           Allocate memory of specific size, set it to zero and account it to allocation tag
+ * \param[in]       num: Number of elements to allocate
+ * \param[in]       size: Size of each element
+ * \param[in]       tag: Allocation tag, member of \ref lwcell_mem_tag_t
+ * \return          Memory address on success, `NULL` otherwise
+ * \sa              LWCELL_MEM_CALLOC
+ */
+void*
+lwcell_mem_calloc_tag(size_t num, size_t size, lwcell_mem_tag_t tag) {
+    return mem_calloc_locked(num, size, tag);
+}
+
+#endif /* LWCELL_CFG_MEM_STATS || LWCELL_CFG_MEM_STATIC || __DOXYGEN__ */
+
+#if LWCELL_CFG_MEM_STATS || __DOXYGEN__
+
+/**
+ * \brief           Get memory statistics
+ * \param[out]      stats: Pointer to output structure to fill
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+lwcell_mem_get_stats(lwcell_mem_stats_t* stats) {
+    if (stats == NULL) {
+        return 0;
+    }
+    lwcell_core_lock();
+    LWCELL_MEMCPY(stats, &mem_stats, sizeof(*stats));
+    stats->available_bytes = mem_available_bytes;
+    stats->largest_free_block = mem_get_largest_free();
+    lwcell_core_unlock();
+    return 1;
+}
+
+/**
+ * \brief           Reset peak values and counters of memory statistics
+ * \note            Currently allocated bytes are kept, peaks are set to current values
+ */
+void
+lwcell_mem_reset_stats(void) {
+    lwcell_core_lock();
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(mem_stats.tags); ++i) {
+        mem_stats.tags[i].peak_bytes = mem_stats.tags[i].cur_bytes;
+        mem_stats.tags[i].alloc_cnt = 0;
+        mem_stats.tags[i].fail_cnt = 0;
+    }
+    mem_stats.peak_used_bytes = mem_stats.used_bytes;
+    lwcell_core_unlock();
+}
+
+#endif /* LWCELL_CFG_MEM_STATS || __DOXYGEN__ */
+
 #endif /* !LWCELL_CFG_MEM_CUSTOM || __DOXYGEN__ */
 
 /**
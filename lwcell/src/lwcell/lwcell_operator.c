@@ -91,18 +91,19 @@ lwcell_operator_set(lwcell_operator_mode_t mode, lwcell_operator_format_t format
 }
 
 /**
- * \brief           Scan for available operators
+ * \brief           Queue operator scan command
  * \param[in]       ops: Pointer to array to write found operators
  * \param[in]       opsl: Length of input array in units of elements
  * \param[out]      opf: Pointer to ouput variable to save number of operators found
+ * \param[in]       h: Command handle to link, `NULL` when not used
  * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
  * \param[in]       evt_arg: Custom argument for event callback function
  * \param[in]       blocking: Status whether command should be blocking or not
  * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
  */
-lwcellr_t
-lwcell_operator_scan(lwcell_operator_t* ops, size_t opsl, size_t* opf, const lwcell_api_cmd_evt_fn evt_fn,
-                     void* const evt_arg, const uint32_t blocking) {
+static lwcellr_t
+prv_operator_scan(lwcell_operator_t* ops, size_t opsl, size_t* opf, lwcell_cmd_handle_t* h,
+                  const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, const uint32_t blocking) {
     LWCELL_MSG_VAR_DEFINE(msg);
 
     if (opf != NULL) {
@@ -111,10 +112,84 @@ lwcell_operator_scan(lwcell_operator_t* ops, size_t opsl, size_t* opf, const lwc
 
     LWCELL_MSG_VAR_ALLOC(msg, blocking);
     LWCELL_MSG_VAR_SET_EVT(msg, evt_fn, evt_arg);
+    LWCELL_MSG_VAR_SET_HANDLE(msg, h);
     LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_COPS_GET_OPT;
+    LWCELL_MSG_VAR_REF(msg).low_prio = 1;
     LWCELL_MSG_VAR_REF(msg).msg.cops_scan.ops = ops;
     LWCELL_MSG_VAR_REF(msg).msg.cops_scan.opsl = opsl;
     LWCELL_MSG_VAR_REF(msg).msg.cops_scan.opf = opf;
 
     return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 120000);
 }
+
+/**
+ * \brief           Scan for available operators
+ *
+ * Scan runs with low priority, commands queued before it starts are executed first.
+ * Every parsed operator is reported with \ref LWCELL_EVT_OPERATOR_SCAN_ENTRY event while scan is in progress,
+ * use \ref lwcell_operator_scan_cancel to finish it with entries received so far.
+ *
+ * \param[in]       ops: Pointer to array to write found operators
+ * \param[in]       opsl: Length of input array in units of elements
+ * \param[out]      opf: Pointer to ouput variable to save number of operators found
+ * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
+ * \param[in]       evt_arg: Custom argument for event callback function
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_operator_scan(lwcell_operator_t* ops, size_t opsl, size_t* opf, const lwcell_api_cmd_evt_fn evt_fn,
+                     void* const evt_arg, const uint32_t blocking) {
+    return prv_operator_scan(ops, opsl, opf, NULL, evt_fn, evt_arg, blocking);
+}
+
+#if LWCELL_CFG_CMD_HANDLE || __DOXYGEN__
+
+/**
+ * \brief           Scan for available operators with command handle
+ *
+ * Same as \ref lwcell_operator_scan, handle may set deadline of scan and cancel it with \ref lwcell_cmd_cancel
+ *
+ * \param[in]       ops: Pointer to array to write found operators
+ * \param[in]       opsl: Length of input array in units of elements
+ * \param[out]      opf: Pointer to ouput variable to save number of operators found
+ * \param[in]       h: Command handle with `timeout` member set. It must stay valid until command finishes
+ * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
+ * \param[in]       evt_arg: Custom argument for event callback function
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_operator_scan_with_handle(lwcell_operator_t* ops, size_t opsl, size_t* opf, lwcell_cmd_handle_t* h,
+                                 const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, const uint32_t blocking) {
+    LWCELL_ASSERT(h != NULL);
+    return prv_operator_scan(ops, opsl, opf, h, evt_fn, evt_arg, blocking);
+}
+
+#endif /* LWCELL_CFG_CMD_HANDLE || __DOXYGEN__ */
+
+/**
+ * \brief           Cancel active or waiting operator scan
+ *
+ * Running scan is aborted by sending single character to device.
+ * It finishes with \ref lwcellOK and entries received until now.
+ * Scan that has not started yet finishes with \ref lwcellERR.
+ *
+ * \note            Function may be called from \ref LWCELL_EVT_OPERATOR_SCAN_ENTRY event
+ * \return          \ref lwcellOK on success, \ref lwcellERR if there is no scan to cancel
+ */
+lwcellr_t
+lwcell_operator_scan_cancel(void) {
+    lwcellr_t res = lwcellERR;
+
+    lwcell_core_lock();
+    if (lwcell.msg != NULL && lwcell.msg->cmd_def == LWCELL_CMD_COPS_GET_OPT) {
+        lwcelli_cmd_abort(lwcell.msg); /* Scan is already sent to device when it is current message */
+        res = lwcellOK;
+    } else if (lwcell.msg_low_prio != NULL && lwcell.msg_low_prio->cmd_def == LWCELL_CMD_COPS_GET_OPT) {
+        lwcell.msg_low_prio->msg.cops_scan.cancel = 1; /* Scan not sent to device yet */
+        res = lwcellOK;
+    }
+    lwcell_core_unlock();
+    return res;
+}
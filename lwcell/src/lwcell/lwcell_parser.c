@@ -33,6 +33,7 @@
  */
 #include "lwcell/lwcell_parser.h"
 #include "lwcell/lwcell_private.h"
+#include "lwcell/lwcell_sms.h"
 
 /**
  * \brief           Parse number from string
@@ -493,8 +494,9 @@ lwcelli_parse_cops_scan(uint8_t ch, uint8_t reset) {
         }
     }
 
-    if (u.f.ccd ||                                                          /* Ignore data after 2 commas in a row */
-        lwcell.msg->msg.cops_scan.opsi >= lwcell.msg->msg.cops_scan.opsl) { /* or if array is full */
+    if (u.f.ccd ||                                                           /* Ignore data after 2 commas in a row */
+        lwcell.msg->msg.cops_scan.opsi >= lwcell.msg->msg.cops_scan.opsl /* or if array is full */
+        || lwcell.msg->msg.cops_scan.cancel) {                           /* or if scan was cancelled */
         return 1;
     }
 
@@ -507,6 +509,11 @@ lwcelli_parse_cops_scan(uint8_t ch, uint8_t reset) {
             if (lwcell.msg->msg.cops_scan.opf != NULL) {
                 *lwcell.msg->msg.cops_scan.opf = lwcell.msg->msg.cops_scan.opsi;
             }
+
+            /* Report entry immediately, scan may take minutes to complete */
+            lwcell.evt.evt.operator_scan_entry.op = &lwcell.msg->msg.cops_scan.ops[lwcell.msg->msg.cops_scan.opsi - 1];
+            lwcell.evt.evt.operator_scan_entry.idx = lwcell.msg->msg.cops_scan.opsi - 1;
+            lwcelli_send_cb(LWCELL_EVT_OPERATOR_SCAN_ENTRY);
         } else if (ch == ',') {
             ++u.f.tn;           /* Go to next term */
             u.f.tp = 0;         /* Go to beginning of next term */
@@ -651,6 +658,79 @@ lwcelli_parse_cmgs(const char* str, size_t* num) {
     return 1;
 }
 
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+
+/**
+ * \brief           Parse header of +CMGR or +CMGL statement in PDU mode
+ * \param[in,out]   src: Pointer to pointer to string to parse, starting with status
+ * \param[out]      e: SMS entry to fill
+ */
+static void
+lwcelli_parse_sms_pdu_header(const char** src, lwcell_sms_entry_t* e) {
+    const char* p = *src;
+
+    switch (lwcelli_parse_number(&p)) {
+        case 0: e->status = LWCELL_SMS_STATUS_UNREAD; break;
+        case 1: e->status = LWCELL_SMS_STATUS_READ; break;
+        case 2: e->status = LWCELL_SMS_STATUS_UNSENT; break;
+        case 3: e->status = LWCELL_SMS_STATUS_SENT; break;
+        default: break;
+    }
+    if (p[0] == ',' && p[1] == '"') { /* Alpha field is optional and often empty */
+        lwcelli_parse_string(&p, e->name, sizeof(e->name), 1);
+    } else if (p[0] == ',') {
+        ++p;
+    }
+    lwcelli_parse_number(&p); /* PDU length, without service center address */
+    lwcell.m.sms.pdu_hex_cnt = 0;
+    *src = p;
+}
+
+/**
+ * \brief           Parse character of SMS PDU line, received after +CMGR or +CMGL statement
+ *
+ * Characters are converted from hex format to binary PDU
+ * and decoded to SMS entry at the end of line.
+ *
+ * \param[in]       e: SMS entry to fill. Set to `NULL` to ignore received data
+ * \param[in]       ch: Received character
+ * \return          `1` when end of line is detected, `0` otherwise
+ */
+uint8_t
+lwcelli_parse_sms_pdu(lwcell_sms_entry_t* e, uint8_t ch) {
+    lwcell_sms_pdu_t info;
+    size_t idx = lwcell.m.sms.pdu_hex_cnt >> 1;
+
+    if (LWCELL_CHARISHEXNUM(ch)) {
+        if (idx < sizeof(lwcell.m.sms.rx_pdu)) {
+            if (lwcell.m.sms.pdu_hex_cnt & 0x01) {
+                lwcell.m.sms.rx_pdu[idx] = (uint8_t)((lwcell.m.sms.rx_pdu[idx] << 4) | LWCELL_CHARHEXTONUM(ch));
+            } else {
+                lwcell.m.sms.rx_pdu[idx] = LWCELL_CHARHEXTONUM(ch);
+            }
+            ++lwcell.m.sms.pdu_hex_cnt;
+        }
+        return 0;
+    } else if (ch != '\n') {
+        return 0;
+    }
+
+    if (e != NULL
+        && lwcell_sms_pdu_decode(lwcell.m.sms.rx_pdu, idx, 1, &info, e->data, sizeof(e->data), &e->length) == lwcellOK) {
+        LWCELL_MEMCPY(e->number, info.number, LWCELL_MIN(sizeof(e->number), sizeof(info.number)));
+        e->number[sizeof(e->number) - 1] = 0;
+        e->dt = info.dt;
+        e->coding = info.coding;
+        e->concat_ref = info.concat_ref;
+        e->concat_total = info.concat_total;
+        e->concat_seq = info.concat_seq;
+    }
+    lwcell.m.sms.pdu_hex_cnt = 0;
+    return 1;
+}
+
+#endif /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
+
 /**
  * \brief           Parse +CMGR statement
  * \todo            Parse date and time from SMS entry
@@ -666,6 +746,12 @@ lwcelli_parse_cmgr(const char* str) {
 
     e = lwcell.msg->msg.sms_read.entry;
     e->length = 0;
+#if LWCELL_CFG_SMS_PDU
+    if (!lwcell.msg->msg.sms_read.format) {
+        lwcelli_parse_sms_pdu_header(&str, e);
+        return 1;
+    }
+#endif /* LWCELL_CFG_SMS_PDU */
     lwcelli_parse_sms_status(&str, &e->status);
     lwcelli_parse_string(&str, e->number, sizeof(e->number), 1);
     lwcelli_parse_string(&str, e->name, sizeof(e->name), 1);
@@ -684,7 +770,8 @@ uint8_t
 lwcelli_parse_cmgl(const char* str) {
     lwcell_sms_entry_t* e;
 
-    if (!CMD_IS_DEF(LWCELL_CMD_CMGL) || lwcell.msg->msg.sms_list.ei >= lwcell.msg->msg.sms_list.etr) {
+    if (!CMD_IS_DEF(LWCELL_CMD_CMGL) || lwcell.msg->msg.sms_list.ei >= lwcell.msg->msg.sms_list.etr
+        || lwcell.msg->msg.sms_list.stop) {
         return 0;
     }
 
@@ -692,10 +779,19 @@ lwcelli_parse_cmgl(const char* str) {
         str += 7;
     }
 
-    e = &lwcell.msg->msg.sms_list.entries[lwcell.msg->msg.sms_list.ei];
+    e = LWCELL_SMS_LIST_ENTRY(lwcell.msg);
+    if (lwcell.msg->msg.sms_list.fn != NULL) {
+        LWCELL_MEMSET(e, 0x00, sizeof(*e)); /* Scratch entry is reused */
+    }
     e->length = 0;
     e->mem = lwcell.msg->msg.sms_list.mem;          /* Manually set memory */
     e->pos = LWCELL_SZ(lwcelli_parse_number(&str)); /* Scan position */
+#if LWCELL_CFG_SMS_PDU
+    if (!lwcell.msg->msg.sms_list.format) {
+        lwcelli_parse_sms_pdu_header(&str, e);
+        return 1;
+    }
+#endif /* LWCELL_CFG_SMS_PDU */
     lwcelli_parse_sms_status(&str, &e->status);
     lwcelli_parse_string(&str, e->number, sizeof(e->number), 1);
     lwcelli_parse_string(&str, e->name, sizeof(e->name), 1);
@@ -725,6 +821,55 @@ lwcelli_parse_cmti(const char* str, uint8_t send_evt) {
     return 1;
 }
 
+#if LWCELL_CFG_SMS_DIRECT || __DOXYGEN__
+
+/**
+ * \brief           Parse received +CMT header of directly routed SMS
+ *
+ * Text mode header is `+CMT: <oa>,[<alpha>],<scts>` and ends with quoted time stamp,
+ * PDU mode header is `+CMT: [<alpha>],<length>` and ends with number.
+ * Message body follows in next line.
+ *
+ * \param[in]       str: Input string
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+lwcelli_parse_cmt(const char* str) {
+    lwcell_sms_entry_t* e = &lwcell.m.sms.cmt_entry;
+    size_t len = strlen(str);
+
+    if (*str == '+') {
+        str += 6;
+        len -= 6;
+    }
+    while (len > 0 && (str[len - 1] == '\r' || str[len - 1] == '\n')) {
+        --len;
+    }
+
+    LWCELL_MEMSET(e, 0x00, sizeof(*e));
+    e->mem = LWCELL_MEM_UNKNOWN; /* Message is not stored */
+    e->status = LWCELL_SMS_STATUS_UNREAD;
+    if (len > 0 && str[len - 1] == '"') {
+        lwcelli_parse_string(&str, e->number, sizeof(e->number), 1);
+        lwcelli_parse_string(&str, e->name, sizeof(e->name), 1);
+        lwcelli_parse_datetime(&str, &e->dt);
+        lwcell.m.sms.cmt_read = 1;
+    } else {
+#if LWCELL_CFG_SMS_PDU
+        if (*str == '"') {
+            lwcelli_parse_string(&str, e->name, sizeof(e->name), 1);
+        }
+        lwcell.m.sms.pdu_hex_cnt = 0;
+        lwcell.m.sms.cmt_read = 2;
+#else  /* LWCELL_CFG_SMS_PDU */
+        lwcell.m.sms.cmt_read = 3; /* PDU cannot be decoded, skip it */
+#endif /* !LWCELL_CFG_SMS_PDU */
+    }
+    return 1;
+}
+
+#endif /* LWCELL_CFG_SMS_DIRECT || __DOXYGEN__ */
+
 /**
  * \brief           Parse +CPMS statement
  * \param[in]       str: Input string
@@ -982,4 +1127,136 @@ lwcelli_parse_ipd(const char* str) {
     return 1;
 }
 
+#if LWCELL_CFG_CONN_ADAPTIVE_SEND || __DOXYGEN__
+
+/**
+ * \brief           Parse +CIPSEND response with maximal data length for connection
+ *
+ * Response is in format `+CIPSEND: <n>,<size>`, one line per connection.
+ * Only line of queried connection is used, other connections keep their adapted length
+ *
+ * \param[in]       str: Input string to parse
+ * \param[in]       num: Connection number query was issued for
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+lwcelli_parse_cipsend_max(const char* str, uint8_t num) {
+    lwcell_conn_p c;
+    uint8_t conn;
+    size_t len;
+
+    if (*str == '+') {
+        str += 10;
+    }
+
+    conn = lwcelli_parse_number(&str);                              /* Parse number for connection number */
+    len = lwcelli_parse_number(&str);                               /* Parse maximal data length */
+
+    c = conn < LWCELL_CFG_MAX_CONNS ? &lwcell.m.conns[conn] : NULL; /* Get connection handle */
+    if (c == NULL || conn != num || len == 0) {
+        return 0;
+    }
+
+    c->send_max = len;          /* Device maximum, chunk is further limited by data in send buffer */
+    c->send_chunk = c->send_max; /* Start with maximal length, adapt later */
+    return 1;
+}
+
+#endif /* LWCELL_CFG_CONN_ADAPTIVE_SEND || __DOXYGEN__ */
+
+#if LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__
+
+/**
+ * \brief           Parse +CIPRXGET statement in manual receive mode
+ *
+ * Mode `1` is notification about new data in device buffer,
+ * mode `2` is response to read command, followed by actual data
+ *
+ * \param[in]       str: Input string to parse
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+lwcelli_parse_ciprxget(const char* str) {
+    lwcell_conn_p c;
+    lwcell_pbuf_p buff;
+    uint8_t mode, conn;
+    size_t len;
+
+    if (*str == '+') {
+        str += 11;
+    }
+
+    mode = lwcelli_parse_number(&str);                              /* Parse mode of the statement */
+    conn = lwcelli_parse_number(&str);                              /* Parse number for connection number */
+
+    c = conn < LWCELL_CFG_MAX_CONNS ? &lwcell.m.conns[conn] : NULL; /* Get connection handle */
+    if (c == NULL) {                                                /* Invalid connection number */
+        return 0;
+    }
+
+    if (mode == 1) {              /* New data available in device buffer */
+        c->status.f.rx_avail = 1;
+        lwcelli_conn_manual_rx_start(c);
+    } else if (mode == 2 && CMD_IS_CUR(LWCELL_CMD_CIPRXGET)) {
+        len = lwcelli_parse_number(&str);                      /* Number of bytes device will send now */
+        c->status.f.rx_avail = lwcelli_parse_number(&str) > 0; /* Number of bytes still in device buffer */
+
+        /* Use buffer prepared when command was sent */
+        buff = lwcell.msg->msg.conn_recv.buff;
+        lwcell.msg->msg.conn_recv.buff = NULL;
+        if (buff != NULL && (len == 0 || !c->status.f.active || c->status.f.in_closing)) {
+            lwcell_pbuf_free_s(&buff);
+        } else if (buff != NULL && len < buff->len) {
+            buff->len = len; /* Device has less data than requested */
+            buff->tot_len = len;
+        }
+
+        if (len > 0) {
+            lwcell.m.ipd.read = 1;      /* Start reading network data */
+            lwcell.m.ipd.tot_len = len; /* Total number of bytes in this received packet */
+            lwcell.m.ipd.rem_len = len; /* Number of remaining bytes to read */
+            lwcell.m.ipd.conn = c;      /* Pointer to connection we have data for */
+            lwcell.m.ipd.buff = buff;   /* Buffer for data, allocated before */
+        }
+    }
+    return 1;
+}
+
+#endif /* LWCELL_CFG_CONN_MANUAL_RX || __DOXYGEN__ */
+
 #endif /* LWCELL_CFG_CONN */
+
+#if LWCELL_CFG_DNS || __DOXYGEN__
+
+/**
+ * \brief           Parse received +CDNSGIP response with resolved host name
+ *
+ * Successful response is in format `+CDNSGIP: 1,"host","ip1"[,"ip2"]`,
+ * failure is reported as `+CDNSGIP: 0,<err>`
+ *
+ * \param[in]       str: Input string to parse
+ * \param[out]      ip: Pointer to output IP address
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+lwcelli_parse_cdnsgip(const char* str, lwcell_ip_t* ip) {
+    if (*str == '+') {
+        str += 10;
+    }
+    if (lwcelli_parse_number(&str) != 1) {
+        return 0;
+    }
+    lwcelli_parse_string(&str, NULL, 0, 1); /* Skip host name */
+    if (*str == ',') {
+        ++str;
+    }
+    if (*str == '"') {
+        ++str;
+    }
+    if (!LWCELL_CHARISNUM(*str)) {          /* IPv6 address or no address at all */
+        return 0;
+    }
+    return lwcelli_parse_ip(&str, ip);
+}
+
+#endif /* LWCELL_CFG_DNS || __DOXYGEN__ */
@@ -34,8 +34,6 @@
 #include "lwcell/lwcell_pbuf.h"
 #include "lwcell/lwcell_private.h"
 
-/* Set size of pbuf structure */
-#define SIZEOF_PBUF_STRUCT LWCELL_MEM_ALIGN(sizeof(lwcell_pbuf_t))
 #define SET_NEW_LEN(v, len)                                                                                            \
     do {                                                                                                               \
         if ((v) != NULL) {                                                                                             \
@@ -43,6 +41,98 @@
         }                                                                                                              \
     } while (0)
 
+#if LWCELL_CFG_PBUF_POOL || __DOXYGEN__
+
+/**
+ * \brief           Packet buffer pool structure
+ */
+typedef struct {
+    lwcell_pbuf_p free;             /*!< List of free entries, linked with `next` member */
+    lwcell_pbuf_pool_stats_t stats; /*!< Pool statistics */
+} pbuf_pool_t;
+
+/* Memory for all pools, declared as `size_t` array to get aligned start address */
+static size_t pbuf_pool_mem[(PBUF_POOL_MEM_SIZE + sizeof(size_t) - 1) / sizeof(size_t) + 1];
+static pbuf_pool_t pbuf_pools[] = {
+    {NULL, {LWCELL_CFG_PBUF_POOL_1_SIZE, LWCELL_CFG_PBUF_POOL_1_CNT, 0, 0, 0}},
+    {NULL, {LWCELL_CFG_PBUF_POOL_2_SIZE, LWCELL_CFG_PBUF_POOL_2_CNT, 0, 0, 0}},
+    {NULL, {LWCELL_CFG_PBUF_POOL_3_SIZE, LWCELL_CFG_PBUF_POOL_3_CNT, 0, 0, 0}},
+};
+static uint8_t pbuf_pools_ready;
+
+/**
+ * \brief           Split pool memory to entries and link them to free lists
+ * \note            Function must be called with core locked
+ */
+static void
+pbuf_pool_init(void) {
+    uint8_t* mem = (uint8_t*)pbuf_pool_mem;
+
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(pbuf_pools); ++i) {
+        pbuf_pool_t* pool = &pbuf_pools[i];
+        size_t entry_size = PBUF_POOL_ENTRY_SIZE(pool->stats.size);
+
+        for (size_t j = 0; j < pool->stats.cnt; ++j, mem += entry_size) {
+            lwcell_pbuf_p p = (void*)mem;
+
+            p->next = pool->free;
+            p->pool = LWCELL_U8(i + 1);
+            pool->free = p;
+        }
+    }
+    pbuf_pools_ready = 1;
+}
+
+/**
+ * \brief           Take packet buffer from the smallest pool with large enough and free entry
+ * \param[in]       len: Length of payload memory
+ * \return          Pointer to packet buffer, `NULL` if no pool entry available
+ */
+static lwcell_pbuf_p
+pbuf_pool_alloc(size_t len) {
+    lwcell_pbuf_p p = NULL;
+
+    lwcell_core_lock();
+    if (!pbuf_pools_ready) {
+        pbuf_pool_init();
+    }
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(pbuf_pools); ++i) {
+        pbuf_pool_t* pool = &pbuf_pools[i];
+
+        if (pool->stats.cnt == 0 || pool->stats.size < len) {
+            continue;
+        }
+        if (pool->free != NULL) {
+            p = pool->free;
+            pool->free = p->next;
+            if (++pool->stats.used > pool->stats.used_max) {
+                pool->stats.used_max = pool->stats.used;
+            }
+            break;
+        }
+        ++pool->stats.exhausted; /* Try with next larger pool */
+    }
+    lwcell_core_unlock();
+    return p;
+}
+
+/**
+ * \brief           Return packet buffer back to its pool
+ * \param[in]       p: Packet buffer taken from pool
+ */
+static void
+pbuf_pool_free(lwcell_pbuf_p p) {
+    pbuf_pool_t* pool = &pbuf_pools[p->pool - 1];
+
+    lwcell_core_lock();
+    p->next = pool->free;
+    pool->free = p;
+    --pool->stats.used;
+    lwcell_core_unlock();
+}
+
+#endif /* LWCELL_CFG_PBUF_POOL || __DOXYGEN__ */
+
 /**
  * \brief           Skip pbufs for desired offset
  * \param[in]       p: Source pbuf to skip
@@ -66,6 +156,37 @@ pbuf_skip(lwcell_pbuf_p p, size_t off, size_t* new_off) {
     return p;
 }
 
+/**
+ * \brief           Compare pbuf chain memory with data, segment by segment
+ * \note            Function assumes valid input parameters and enough data in chain
+ * \param[in]       p: Pbuf where compare starts
+ * \param[in]       off: Offset in `p` where compare starts. It may be equal to `p->len`
+ * \param[in]       d: Data to compare with
+ * \param[in]       len: Length of data in units of bytes
+ * \return          `0` if equal, position of first different byte in data plus `1` otherwise
+ */
+static size_t
+pbuf_cmp_chain(lwcell_pbuf_p p, size_t off, const uint8_t* d, size_t len) {
+    size_t i = 0, seg_len;
+
+    for (; p != NULL && i < len; p = p->next, off = 0) {
+        if (off >= p->len) { /* Nothing to compare in this pbuf */
+            continue;
+        }
+        seg_len = LWCELL_MIN(p->len - off, len - i);
+        if (memcmp(&p->payload[off], &d[i], seg_len) != 0) {
+            /* Locate exact byte only on mismatch */
+            for (size_t k = 0; k < seg_len; ++k) {
+                if (p->payload[off + k] != d[i + k]) {
+                    return i + k + 1;
+                }
+            }
+        }
+        i += seg_len;
+    }
+    return i < len ? (i + 1) : 0;
+}
+
 /**
  * \brief           Allocate packet buffer for network data of specific size
  * \param[in]       len: Length of payload memory to allocate
@@ -75,7 +196,17 @@ lwcell_pbuf_p
 lwcell_pbuf_new(size_t len) {
     lwcell_pbuf_p p;
 
-    p = lwcell_mem_malloc(SIZEOF_PBUF_STRUCT + sizeof(*p->payload) * len);
+#if LWCELL_CFG_PBUF_POOL
+    /* Pools first, dynamic allocation is only a fallback */
+    if ((p = pbuf_pool_alloc(len)) == NULL) {
+        p = LWCELL_MEM_MALLOC(SIZEOF_PBUF_STRUCT + sizeof(*p->payload) * len, LWCELL_MEM_TAG_PBUF);
+        if (p != NULL) {
+            p->pool = 0;
+        }
+    }
+#else  /* LWCELL_CFG_PBUF_POOL */
+    p = LWCELL_MEM_MALLOC(SIZEOF_PBUF_STRUCT + sizeof(*p->payload) * len, LWCELL_MEM_TAG_PBUF);
+#endif /* !LWCELL_CFG_PBUF_POOL */
     LWCELL_DEBUGW(LWCELL_CFG_DBG_PBUF | LWCELL_DBG_TYPE_TRACE, p == NULL,
                   "[LWCELL PBUF] Failed to allocate %u bytes\r\n", (unsigned)len);
     LWCELL_DEBUGW(LWCELL_CFG_DBG_PBUF | LWCELL_DBG_TYPE_TRACE, p != NULL, "[LWCELL PBUF] Allocated %u bytes on %p\r\n",
@@ -122,6 +253,12 @@ lwcell_pbuf_free(lwcell_pbuf_p pbuf) {
                           "[LWCELL PBUF] Deallocating %p with len/tot_len: %u/%u\r\n", (void*)p, (unsigned)p->len,
                           (unsigned)p->tot_len);
             pn = p->next;                  /* Save next entry */
+#if LWCELL_CFG_PBUF_POOL
+            if (p->pool > 0) {
+                pbuf_pool_free(p);         /* Return entry to its pool */
+                p = NULL;
+            }
+#endif                                     /* LWCELL_CFG_PBUF_POOL */
             lwcell_mem_free_s((void**)&p); /* Free memory for pbuf */
             p = pn;                        /* Restore with next entry */
             ++cnt;                         /* Increase number of freed pbufs */
@@ -396,15 +533,31 @@ lwcell_pbuf_get_at(const lwcell_pbuf_p pbuf, size_t pos, uint8_t* el) {
  */
 size_t
 lwcell_pbuf_memfind(const lwcell_pbuf_p pbuf, const void* needle, size_t len, size_t off) {
-    if (pbuf != NULL && needle != NULL && pbuf->tot_len >= (len + off)) { /* Check if valid entries */
-        /*
-         * Try entire buffer element by element
-         * and in case we have a match, report it
-         */
-        for (size_t i = off; i <= pbuf->tot_len - len; ++i) {
-            if (!lwcell_pbuf_memcmp(pbuf, needle, len, i)) { /* Check if identical */
-                return i;                                    /* We have a match! */
+    const uint8_t *n = needle, *d, *f;
+    lwcell_pbuf_p p;
+    size_t pos, last, seg_off, seg_len;
+
+    if (pbuf == NULL || needle == NULL || len == 0 /* Check if valid entries */
+        || pbuf->tot_len < (len + off)) {
+        return LWCELL_SIZET_MAX;
+    }
+
+    /*
+     * Walk the chain only once, segment by segment.
+     * First needle byte is searched with memchr in linear segment memory,
+     * remaining bytes are compared from the match onward, crossing pbuf boundaries if necessary
+     */
+    last = pbuf->tot_len - len; /* Last position where needle can still start */
+    p = pbuf_skip(pbuf, off, &seg_off);
+    for (pos = off - seg_off; p != NULL && pos <= last; pos += p->len, p = p->next, seg_off = 0) {
+        d = p->payload;
+        seg_len = LWCELL_MIN(p->len, last - pos + 1);
+        while (seg_off < seg_len && (f = memchr(&d[seg_off], n[0], seg_len - seg_off)) != NULL) {
+            seg_off = (size_t)(f - d);
+            if (len == 1 || pbuf_cmp_chain(p, seg_off + 1, &n[1], len - 1) == 0) {
+                return pos + seg_off; /* We have a match! */
             }
+            ++seg_off;
         }
     }
     return LWCELL_SIZET_MAX; /* Return maximal value of size_t variable to indicate error */
@@ -436,8 +589,6 @@ lwcell_pbuf_strfind(const lwcell_pbuf_p pbuf, const char* str, size_t off) {
 size_t
 lwcell_pbuf_memcmp(const lwcell_pbuf_p pbuf, const void* data, size_t len, size_t offset) {
     lwcell_pbuf_p p;
-    uint8_t el;
-    const uint8_t* d = data;
 
     if (pbuf == NULL || data == NULL || len == 0 /* Input parameters check */
         || pbuf->tot_len < (offset + len)) {     /* Check of valid ranges */
@@ -445,25 +596,11 @@ lwcell_pbuf_memcmp(const lwcell_pbuf_p pbuf, const void* data, size_t len, size_
     }
 
     /*
-     * Find start pbuf to have more optimized search at the end
-     * Since we had a check on beginning, we must pass this for loop without any problems
-     */
-    for (p = pbuf; p != NULL && p->len <= offset; p = p->next) {
-        offset -= p->len; /* Decrease offset by length of pbuf */
-    }
-
-    /*
-     * We have known starting pbuf.
-     * Now it is time to check byte by byte from pbuf and memory
-     *
-     * Use byte by byte read function to inspect bytes separatelly
+     * Find start pbuf and compare linear memory of each segment.
+     * Since we had a check on beginning, chain has enough data
      */
-    for (size_t i = 0; i < len; ++i) {
-        if (!lwcell_pbuf_get_at(p, offset + i, &el) || el != d[i]) { /* Get value from pbuf at specific offset */
-            return offset + 1;                                       /* Return value from offset where it failed */
-        }
-    }
-    return 0; /* Memory matches at this point */
+    p = pbuf_skip(pbuf, offset, &offset);
+    return pbuf_cmp_chain(p, offset, data, len);
 }
 
 /**
@@ -509,6 +646,52 @@ lwcell_pbuf_get_linear_addr(const lwcell_pbuf_p pbuf, size_t offset, size_t* new
     return &p->payload[offset]; /* Return memory at desired offset */
 }
 
+/**
+ * \brief           Initialize iterator over linear memory segments of pbuf chain
+ * \param[out]      it: Iterator to initialize
+ * \param[in]       pbuf: Pbuf chain to iterate
+ * \param[in]       offset: Start offset in pbuf chain
+ * \return          `1` on success, `0` otherwise
+ * \sa              lwcell_pbuf_iter_next
+ */
+uint8_t
+lwcell_pbuf_iter_init(lwcell_pbuf_iter_t* it, const lwcell_pbuf_p pbuf, size_t offset) {
+    if (it == NULL) {
+        return 0;
+    }
+    it->pbuf = pbuf_skip(pbuf, offset, &it->off);
+    return it->pbuf != NULL || (pbuf != NULL && pbuf->tot_len == offset);
+}
+
+/**
+ * \brief           Get next linear memory segment from pbuf chain
+ *
+ * Chain is walked only once, without restarting from its head for every call.
+ * Empty pbufs in the chain are skipped.
+ *
+ * \param[in,out]   it: Iterator, initialized with \ref lwcell_pbuf_iter_init
+ * \param[out]      data: Pointer to output variable to save segment memory address
+ * \param[out]      len: Pointer to output variable to save segment length in units of bytes
+ * \return          `1` when segment is returned, `0` when there is no more data in chain
+ */
+uint8_t
+lwcell_pbuf_iter_next(lwcell_pbuf_iter_t* it, const uint8_t** data, size_t* len) {
+    if (it == NULL || data == NULL || len == NULL) {
+        return 0;
+    }
+    for (; it->pbuf != NULL && it->off >= it->pbuf->len; it->pbuf = it->pbuf->next) {
+        it->off = 0; /* Skip empty or fully consumed pbufs */
+    }
+    if (it->pbuf == NULL) {
+        return 0;
+    }
+    *data = &it->pbuf->payload[it->off];
+    *len = it->pbuf->len - it->off;
+    it->pbuf = it->pbuf->next; /* Prepare next segment */
+    it->off = 0;
+    return 1;
+}
+
 /**
  * \brief           Get data pointer from packet buffer
  * \param[in]       pbuf: Packet buffer
@@ -593,6 +776,27 @@ lwcell_pbuf_skip(lwcell_pbuf_p pbuf, size_t offset, size_t* new_offset) {
     return pbuf_skip(pbuf, offset, new_offset); /* Skip pbufs with internal function */
 }
 
+#if LWCELL_CFG_PBUF_POOL || __DOXYGEN__
+
+/**
+ * \brief           Get statistics for packet buffer pool
+ * \param[in]       pool: Pool index, starting with `0` for the smallest pool
+ * \param[out]      stats: Pointer to output statistics structure
+ * \return          `1` on success, `0` if pool does not exist
+ */
+uint8_t
+lwcell_pbuf_pool_get_stats(size_t pool, lwcell_pbuf_pool_stats_t* stats) {
+    if (pool >= LWCELL_ARRAYSIZE(pbuf_pools) || stats == NULL) {
+        return 0;
+    }
+    lwcell_core_lock();
+    LWCELL_MEMCPY(stats, &pbuf_pools[pool].stats, sizeof(*stats));
+    lwcell_core_unlock();
+    return 1;
+}
+
+#endif /* LWCELL_CFG_PBUF_POOL || __DOXYGEN__ */
+
 /**
  * \brief           Dump and debug pbuf chain
  * \param[in]       p: Head pbuf to dump
@@ -74,6 +74,227 @@ check_mem(lwcell_mem_t mem, uint8_t can_curr) {
     return res;
 }
 
+#if LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__
+
+/**
+ * \brief           Compare phone numbers by trailing digits
+ *
+ * Non-digit characters are ignored, up to \ref LWCELL_CFG_PHONEBOOK_MIRROR_NUM_DIGITS digits are compared
+ *
+ * \param[in]       a: First number
+ * \param[in]       b: Second number
+ * \return          Negative, `0` or positive value when `a` is lower, equal or greater than `b`
+ */
+static int
+pb_mirror_num_cmp(const char* a, const char* b) {
+    const char *pa = a + strlen(a), *pb = b + strlen(b);
+    size_t n = LWCELL_CFG_PHONEBOOK_MIRROR_NUM_DIGITS > 0 ? LWCELL_CFG_PHONEBOOK_MIRROR_NUM_DIGITS : SIZE_MAX;
+
+    for (; n > 0; --n) {
+        while (pa > a && !LWCELL_CHARISNUM(pa[-1])) {
+            --pa;
+        }
+        while (pb > b && !LWCELL_CHARISNUM(pb[-1])) {
+            --pb;
+        }
+        if (pa == a || pb == b) {
+            return (pa != a) - (pb != b); /* Shorter number is lower */
+        }
+        --pa;
+        --pb;
+        if (*pa != *pb) {
+            return *pa - *pb;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Compare entry names, case insensitive
+ * \param[in]       name: Entry name
+ * \param[in]       str: Name or prefix to compare with
+ * \param[in]       prefix: Set to `1` to treat `str` as prefix, entry name starting with it is equal
+ * \return          Negative, `0` or positive value when `name` is lower, equal or greater than `str`
+ */
+static int
+pb_mirror_name_cmp(const char* name, const char* str, uint8_t prefix) {
+    int ca, cb;
+
+    for (;; ++name, ++str) {
+        if (prefix && *str == '\0') {
+            return 0;
+        }
+        ca = (*name >= 'A' && *name <= 'Z') ? (*name - 'A' + 'a') : *name;
+        cb = (*str >= 'A' && *str <= 'Z') ? (*str - 'A' + 'a') : *str;
+        if (ca != cb || ca == '\0') {
+            return ca - cb;
+        }
+    }
+}
+
+/**
+ * \brief           Insert entry to number and name indexes of local mirror
+ * \param[in]       m: Local mirror
+ * \param[in]       n: Number of entries already in indexes
+ * \param[in]       ei: Entry index to insert
+ */
+static void
+pb_mirror_index_add(lwcell_pb_mirror_t* m, size_t n, uint16_t ei) {
+    size_t j;
+
+    for (j = n; j > 0 && pb_mirror_num_cmp(m->entries[m->idx_num[j - 1]].number, m->entries[ei].number) > 0; --j) {
+        m->idx_num[j] = m->idx_num[j - 1];
+    }
+    m->idx_num[j] = ei;
+    for (j = n; j > 0 && pb_mirror_name_cmp(m->entries[m->idx_name[j - 1]].name, m->entries[ei].name, 0) > 0; --j) {
+        m->idx_name[j] = m->idx_name[j - 1];
+    }
+    m->idx_name[j] = ei;
+}
+
+/**
+ * \brief           Remove entry from index of local mirror
+ * \param[in]       idx: Index array
+ * \param[in]       n: Number of entries in index
+ * \param[in]       ei: Entry index to remove
+ */
+static void
+pb_mirror_index_del(uint16_t* idx, size_t n, uint16_t ei) {
+    size_t j;
+
+    for (j = 0; j < n && idx[j] != ei; ++j) {}
+    for (; j + 1 < n; ++j) {
+        idx[j] = idx[j + 1];
+    }
+}
+
+/**
+ * \brief           Rename entry in index of local mirror after entry moved to new slot
+ * \param[in]       idx: Index array
+ * \param[in]       n: Number of entries in index
+ * \param[in]       from: Old entry index
+ * \param[in]       to: New entry index
+ */
+static void
+pb_mirror_index_move(uint16_t* idx, size_t n, uint16_t from, uint16_t to) {
+    size_t j;
+
+    for (j = 0; j < n && idx[j] != from; ++j) {}
+    if (j < n) {
+        idx[j] = to;
+    }
+}
+
+/**
+ * \brief           Get entry index in local mirror for memory position
+ * \param[in]       pos: Position in memory
+ * \return          Entry index or number of entries if position is empty
+ */
+static size_t
+pb_mirror_find_pos(size_t pos) {
+    lwcell_pb_mirror_t* m = &lwcell.m.pb.mirror;
+    size_t i;
+
+    for (i = 0; i < m->cnt && m->entries[i].pos != pos; ++i) {}
+    return i;
+}
+
+/**
+ * \brief           Finish loading of local mirror after `+CPBR` command
+ * \note            Memory information must be valid from previous `+CPBS` command
+ * \param[in]       msg: Pointer to mirror load message
+ * \param[in]       is_ok: Set to `1` if entries were read successfully
+ * \return          `1` when mirror holds all entries, `0` otherwise
+ */
+uint8_t
+lwcelli_pb_mirror_loaded(lwcell_msg_t* msg, uint8_t is_ok) {
+    lwcell_pb_mirror_t* m = &lwcell.m.pb.mirror;
+    size_t i;
+
+    m->mem = lwcell.m.pb.mem.current;
+    m->total = lwcell.m.pb.mem.total;
+    m->cnt = msg->msg.pb_list.ei;
+    for (i = 0; i < m->cnt; ++i) {
+        m->entries[i].mem = m->mem;
+        pb_mirror_index_add(m, i, (uint16_t)i); /* Insertion sort, done once per load */
+    }
+
+    /* Entries not fitting to mirror are lost, such mirror cannot be used for lookups */
+    m->valid = is_ok && lwcell.m.pb.mem.used <= LWCELL_ARRAYSIZE(m->entries);
+    return m->valid;
+}
+
+/**
+ * \brief           Get first free position in current memory according to local mirror
+ *
+ * Used to place new entry to known position instead of letting device choose it
+ *
+ * \return          Free position or `0` if unknown or memory is full
+ */
+size_t
+lwcelli_pb_mirror_free_pos(void) {
+    lwcell_pb_mirror_t* m = &lwcell.m.pb.mirror;
+    size_t pos;
+
+    if (!m->valid || m->mem != lwcell.m.pb.mem.current) {
+        return 0;
+    }
+    for (pos = 1; pos <= m->total; ++pos) {
+        if (pb_mirror_find_pos(pos) == m->cnt) {
+            return pos;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Apply successful `+CPBW` write or delete to local mirror
+ * \param[in]       msg: Pointer to phonebook write message
+ */
+void
+lwcelli_pb_mirror_write(lwcell_msg_t* msg) {
+    lwcell_pb_mirror_t* m = &lwcell.m.pb.mirror;
+    lwcell_pb_entry_t* e;
+    size_t i;
+
+    if (!m->valid || m->mem != lwcell.m.pb.mem.current) {
+        return;
+    }
+    i = pb_mirror_find_pos(msg->msg.pb_write.pos);
+
+    /* Only changed slot is moved in indexes, each write is linear in number of entries */
+    if (msg->msg.pb_write.del) {
+        if (i < m->cnt) {
+            pb_mirror_index_del(m->idx_num, m->cnt, (uint16_t)i);
+            pb_mirror_index_del(m->idx_name, m->cnt, (uint16_t)i);
+            if (i != --m->cnt) {
+                m->entries[i] = m->entries[m->cnt]; /* Move last entry to free slot */
+                pb_mirror_index_move(m->idx_num, m->cnt, (uint16_t)m->cnt, (uint16_t)i);
+                pb_mirror_index_move(m->idx_name, m->cnt, (uint16_t)m->cnt, (uint16_t)i);
+            }
+        }
+    } else if (msg->msg.pb_write.pos == 0 || (i == m->cnt && m->cnt >= LWCELL_ARRAYSIZE(m->entries))) {
+        m->valid = 0; /* Position chosen by device or no space, mirror is no longer coherent */
+    } else {
+        if (i == m->cnt) {
+            ++m->cnt;
+        } else {
+            pb_mirror_index_del(m->idx_num, m->cnt, (uint16_t)i);
+            pb_mirror_index_del(m->idx_name, m->cnt, (uint16_t)i);
+        }
+        e = &m->entries[i];
+        LWCELL_MEMSET(e, 0x00, sizeof(*e));
+        e->mem = m->mem;
+        e->pos = msg->msg.pb_write.pos;
+        e->type = msg->msg.pb_write.type;
+        strncpy(e->name, msg->msg.pb_write.name, sizeof(e->name) - 1);
+        strncpy(e->number, msg->msg.pb_write.num, sizeof(e->number) - 1);
+        pb_mirror_index_add(m, m->cnt - 1, (uint16_t)i);
+    }
+}
+
+#endif /* LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__ */
+
 /**
  * \brief           Enable phonebook functionality
  * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
@@ -334,4 +555,153 @@ lwcell_pb_search(lwcell_mem_t mem, const char* search, lwcell_pb_entry_t* entrie
     return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 60000);
 }
 
+#if LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__
+
+/**
+ * \brief           Load all entries of specific memory to local mirror
+ *
+ * Memory size is queried first and all positions are read with single `AT+CPBR=1,N` command.
+ * Mirror is later kept coherent by \ref lwcell_pb_add, \ref lwcell_pb_edit and \ref lwcell_pb_delete
+ * functions when they write to mirrored memory.
+ *
+ * \note            Command fails if memory holds more than \ref LWCELL_CFG_PHONEBOOK_MIRROR_SIZE entries
+ * \param[in]       mem: Memory to mirror. Use \ref LWCELL_MEM_CURRENT to use current memory
+ * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
+ * \param[in]       evt_arg: Custom argument for event callback function
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_pb_mirror_load(lwcell_mem_t mem, const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg,
+                      const uint32_t blocking) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    CHECK_ENABLED();
+    LWCELL_ASSERT(check_mem(mem, 1) == lwcellOK);
+
+    LWCELL_MSG_VAR_ALLOC(msg, blocking);
+    LWCELL_MSG_VAR_SET_EVT(msg, evt_fn, evt_arg);
+
+    lwcell_core_lock();
+    lwcell.m.pb.mirror.valid = 0; /* Entries are overwritten during load */
+    lwcell_core_unlock();
+
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CPBR;
+    if (mem == LWCELL_MEM_CURRENT) {
+        LWCELL_MSG_VAR_REF(msg).cmd = LWCELL_CMD_CPBS_GET; /* First get memory */
+    } else {
+        LWCELL_MSG_VAR_REF(msg).cmd = LWCELL_CMD_CPBS_SET; /* First set memory */
+    }
+
+    LWCELL_MSG_VAR_REF(msg).msg.pb_list.mem = mem;
+    LWCELL_MSG_VAR_REF(msg).msg.pb_list.start_index = 1;
+    LWCELL_MSG_VAR_REF(msg).msg.pb_list.entries = lwcell.m.pb.mirror.entries;
+    LWCELL_MSG_VAR_REF(msg).msg.pb_list.etr = LWCELL_ARRAYSIZE(lwcell.m.pb.mirror.entries);
+    LWCELL_MSG_VAR_REF(msg).msg.pb_list.mirror = 1;
+#if LWCELL_CFG_CMD_LATENCY
+    LWCELL_MSG_VAR_REF(msg).lat_skip = 1; /* Reads whole phonebook */
+#endif /* LWCELL_CFG_CMD_LATENCY */
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 60000);
+}
+
+/**
+ * \brief           Check if local mirror holds all entries of mirrored memory
+ * \return          `1` if mirror is loaded and coherent, `0` otherwise
+ */
+uint8_t
+lwcell_pb_mirror_is_loaded(void) {
+    uint8_t res;
+    lwcell_core_lock();
+    res = lwcell.m.pb.mirror.valid;
+    lwcell_core_unlock();
+    return res;
+}
+
+/**
+ * \brief           Find entry in local mirror by phone number
+ *
+ * Numbers are compared by last \ref LWCELL_CFG_PHONEBOOK_MIRROR_NUM_DIGITS digits,
+ * making it suitable for caller identification on `RING` or `+CLCC` report.
+ * Function does not communicate with device.
+ *
+ * \param[in]       num: Phone number to search for
+ * \param[out]      entry: Pointer to entry variable to save data
+ * \return          \ref lwcellOK when entry was found,
+ *                  \ref lwcellERR if not found or mirror is not loaded, member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_pb_mirror_find_number(const char* num, lwcell_pb_entry_t* entry) {
+    lwcell_pb_mirror_t* m = &lwcell.m.pb.mirror;
+    size_t lo = 0, hi, mid;
+    lwcellr_t res = lwcellERR;
+
+    LWCELL_ASSERT(num != NULL);
+    LWCELL_ASSERT(entry != NULL);
+
+    lwcell_core_lock();
+    if (m->valid) {
+        for (hi = m->cnt; lo < hi;) { /* Lower bound in number index */
+            mid = (lo + hi) / 2;
+            if (pb_mirror_num_cmp(m->entries[m->idx_num[mid]].number, num) < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo < m->cnt && pb_mirror_num_cmp(m->entries[m->idx_num[lo]].number, num) == 0) {
+            *entry = m->entries[m->idx_num[lo]];
+            res = lwcellOK;
+        }
+    }
+    lwcell_core_unlock();
+    return res;
+}
+
+/**
+ * \brief           Find entries in local mirror with name starting with prefix
+ *
+ * Names are compared case insensitive and entries are returned sorted by name.
+ * Function does not communicate with device.
+ *
+ * \param[in]       prefix: Name prefix to search for. Use empty string to list all entries
+ * \param[out]      entries: Pointer to array to save entries
+ * \param[in]       etr: Number of entries to read
+ * \param[out]      er: Pointer to output variable to save entries found
+ * \return          \ref lwcellOK when at least one entry was found,
+ *                  \ref lwcellERR if not found or mirror is not loaded, member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_pb_mirror_find_name(const char* prefix, lwcell_pb_entry_t* entries, size_t etr, size_t* er) {
+    lwcell_pb_mirror_t* m = &lwcell.m.pb.mirror;
+    size_t lo = 0, hi, mid, ei = 0;
+
+    LWCELL_ASSERT(prefix != NULL);
+    LWCELL_ASSERT(entries != NULL);
+    LWCELL_ASSERT(etr > 0);
+
+    lwcell_core_lock();
+    if (m->valid) {
+        for (hi = m->cnt; lo < hi;) { /* Lower bound in name index */
+            mid = (lo + hi) / 2;
+            if (pb_mirror_name_cmp(m->entries[m->idx_name[mid]].name, prefix, 0) < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        for (; lo < m->cnt && ei < etr && pb_mirror_name_cmp(m->entries[m->idx_name[lo]].name, prefix, 1) == 0;
+             ++lo, ++ei) {
+            entries[ei] = m->entries[m->idx_name[lo]];
+        }
+    }
+    lwcell_core_unlock();
+    if (er != NULL) {
+        *er = ei;
+    }
+    return ei > 0 ? lwcellOK : lwcellERR;
+}
+
+#endif /* LWCELL_CFG_PHONEBOOK_MIRROR || __DOXYGEN__ */
+
 #endif /* LWCELL_CFG_PHONEBOOK || __DOXYGEN__ */
@@ -133,6 +133,38 @@ lwcell_sms_disable(const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, cons
     return lwcellOK;
 }
 
+/**
+ * \brief           Queue SMS text send command
+ * \param[in]       num: String number
+ * \param[in]       text: Text to send. Maximal `160` characters
+ * \param[in]       h: Command handle to link, `NULL` when not used
+ * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
+ * \param[in]       evt_arg: Custom argument for event callback function
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t otherwise
+ */
+static lwcellr_t
+prv_sms_send(const char* num, const char* text, lwcell_cmd_handle_t* h, const lwcell_api_cmd_evt_fn evt_fn,
+             void* const evt_arg, const uint32_t blocking) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    LWCELL_ASSERT(num != NULL && num[0] > 0);
+    LWCELL_ASSERT(text != NULL && text[0] > 0 && strlen(text) <= 160);
+    CHECK_ENABLED(); /* Check if enabled */
+    CHECK_READY();   /* Check if ready */
+
+    LWCELL_MSG_VAR_ALLOC(msg, blocking);
+    LWCELL_MSG_VAR_SET_EVT(msg, evt_fn, evt_arg);
+    LWCELL_MSG_VAR_SET_HANDLE(msg, h);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CMGS;
+    LWCELL_MSG_VAR_REF(msg).cmd = LWCELL_CMD_CMGF;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.num = num;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.text = text;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.format = 1; /* Send as plain text */
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 60000);
+}
+
 /**
  * \brief           Send SMS text to phone number
  * \param[in]       num: String number
@@ -145,24 +177,399 @@ lwcell_sms_disable(const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, cons
 lwcellr_t
 lwcell_sms_send(const char* num, const char* text, const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg,
                 const uint32_t blocking) {
+    return prv_sms_send(num, text, NULL, evt_fn, evt_arg, blocking);
+}
+
+#if LWCELL_CFG_CMD_HANDLE || __DOXYGEN__
+
+/**
+ * \brief           Send SMS text to phone number with command handle
+ *
+ * Same as \ref lwcell_sms_send, handle may set deadline of send and cancel it with \ref lwcell_cmd_cancel
+ *
+ * \param[in]       num: String number
+ * \param[in]       text: Text to send. Maximal `160` characters
+ * \param[in]       h: Command handle with `timeout` member set. It must stay valid until command finishes
+ * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
+ * \param[in]       evt_arg: Custom argument for event callback function
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_sms_send_with_handle(const char* num, const char* text, lwcell_cmd_handle_t* h,
+                            const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, const uint32_t blocking) {
+    LWCELL_ASSERT(h != NULL);
+    return prv_sms_send(num, text, h, evt_fn, evt_arg, blocking);
+}
+
+#endif /* LWCELL_CFG_CMD_HANDLE || __DOXYGEN__ */
+
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+
+/**
+ * \brief           Send SMS in PDU mode with selected coding
+ *
+ * Data that do not fit to single message are sent as concatenated message,
+ * with up to `255` parts. Parts are sent one after another within single command.
+ *
+ * \note            Data must stay valid until command finishes
+ * \param[in]       num: Destination number, optionally with leading `+` for international format
+ * \param[in]       data: Data to send. For \ref LWCELL_SMS_CODING_GSM7 and \ref LWCELL_SMS_CODING_UCS2 codings,
+ *                      data are text in UTF-8 format
+ * \param[in]       len: Length of data in units of bytes
+ * \param[in]       coding: User data coding. Text that cannot be represented in GSM 7-bit alphabet
+ *                      must be sent with \ref LWCELL_SMS_CODING_UCS2 coding
+ * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
+ * \param[in]       evt_arg: Custom argument for event callback function
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_sms_send_ex(const char* num, const void* data, size_t len, lwcell_sms_coding_t coding,
+                   const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg, const uint32_t blocking) {
+    const uint8_t* d = data;
+    size_t total = 0, used, units;
     LWCELL_MSG_VAR_DEFINE(msg);
 
-    LWCELL_ASSERT(num != NULL && num[0] > 0);
-    LWCELL_ASSERT(text != NULL && text[0] > 0 && strlen(text) <= 160);
+    LWCELL_ASSERT(num != NULL && num[0] > 0 && strlen(num) <= 21);
+    LWCELL_ASSERT(data != NULL && len > 0);
+    LWCELL_ASSERT(coding <= LWCELL_SMS_CODING_UCS2);
     CHECK_ENABLED(); /* Check if enabled */
     CHECK_READY();   /* Check if ready */
 
+    /* Calculate number of parts, concatenation header is used only when data do not fit to single message */
+    if ((used = lwcelli_sms_pdu_segment(d, len, coding, 0, &units)) == 0) {
+        return lwcellERRPAR;
+    } else if (used == len) {
+        total = 1;
+    } else {
+        for (size_t pos = 0; pos < len; pos += used, ++total) {
+            if ((used = lwcelli_sms_pdu_segment(&d[pos], len - pos, coding, 1, &units)) == 0 || total == 255) {
+                return lwcellERRPAR;
+            }
+        }
+    }
+
     LWCELL_MSG_VAR_ALLOC(msg, blocking);
     LWCELL_MSG_VAR_SET_EVT(msg, evt_fn, evt_arg);
     LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CMGS;
     LWCELL_MSG_VAR_REF(msg).cmd = LWCELL_CMD_CMGF;
     LWCELL_MSG_VAR_REF(msg).msg.sms_send.num = num;
-    LWCELL_MSG_VAR_REF(msg).msg.sms_send.text = text;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.data = d;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.len = len;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.coding = coding;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.total = (uint8_t)total;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.seq = 1;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.format = 0; /* Send in PDU mode */
+#if LWCELL_CFG_CMD_LATENCY
+    LWCELL_MSG_VAR_REF(msg).lat_skip = total > 1;
+#endif /* LWCELL_CFG_CMD_LATENCY */
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 60000 * total);
+}
+
+#endif /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
+
+#if LWCELL_CFG_SMS_DIRECT || __DOXYGEN__
+
+/**
+ * \brief           Enable or disable direct delivery of new messages with `+CMT` indications
+ *
+ * When enabled, new messages are not written to storage. Header and body are parsed by the stack
+ * and reported with \ref LWCELL_EVT_SMS_DELIVER event. When disabled, messages are stored
+ * and reported with \ref LWCELL_EVT_SMS_RECV event.
+ *
+ * \note            Setting is lost on device reset and must be applied again after \ref LWCELL_EVT_SMS_READY event
+ * \note            Text mode message body is expected in single line
+ * \param[in]       en: Set to `1` to route new messages directly, `0` to store them
+ * \param[in]       ack: Set to `1` to acknowledge every message with `AT+CNMA`.
+ *                      Network may resend messages that are not acknowledged.
+ *                      Acknowledge is executed before queued commands, but after command currently in progress.
+ *                      When it comes later than device timeout, device may disable direct delivery,
+ *                      keep long commands away while direct delivery with acknowledge is used
+ * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
+ * \param[in]       evt_arg: Custom argument for event callback function
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_sms_set_direct_delivery(uint8_t en, uint8_t ack, const lwcell_api_cmd_evt_fn evt_fn, void* const evt_arg,
+                               const uint32_t blocking) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    CHECK_ENABLED(); /* Check if enabled */
+    CHECK_READY();   /* Check if ready */
+
+    LWCELL_MSG_VAR_ALLOC(msg, blocking);
+    LWCELL_MSG_VAR_SET_EVT(msg, evt_fn, evt_arg);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CNMI;
+    LWCELL_MSG_VAR_REF(msg).cmd = LWCELL_CMD_CMGF;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_direct.en = en;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_direct.ack = ack;
+#if LWCELL_CFG_SMS_PDU
+    LWCELL_MSG_VAR_REF(msg).msg.sms_direct.format = 0; /* Receive in PDU mode and decode */
+#else  /* LWCELL_CFG_SMS_PDU */
+    LWCELL_MSG_VAR_REF(msg).msg.sms_direct.format = 1; /* Receive as plain text */
+#endif /* !LWCELL_CFG_SMS_PDU */
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 10000);
+}
+
+/**
+ * \brief           Acknowledge directly routed message
+ *
+ * Acknowledge goes before commands waiting in queue, device expects it within short time
+ *
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t otherwise
+ */
+static lwcellr_t
+sms_direct_ack(void) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    LWCELL_MSG_VAR_ALLOC(msg, 0);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CNMA;
+    LWCELL_MSG_VAR_REF(msg).urgent = 1;
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 10000);
+}
+
+/**
+ * \brief           Finish message received with `+CMT` after its body has been parsed
+ * \note            Called from processing thread
+ */
+void
+lwcelli_sms_direct_done(void) {
+    lwcellr_t ack_res = lwcellOK;
+
+    if (lwcell.m.sms.direct_ack) {
+        ack_res = sms_direct_ack(); /* Reported to application with delivered message */
+    }
+    if (lwcell.m.sms.cmt_read != 3) {
+        lwcell.evt.evt.sms_deliver.entry = &lwcell.m.sms.cmt_entry;
+        lwcell.evt.evt.sms_deliver.ack_res = ack_res;
+        lwcelli_send_cb(LWCELL_EVT_SMS_DELIVER);
+    }
+    lwcell.m.sms.cmt_read = 0;
+}
+
+#endif /* LWCELL_CFG_SMS_DIRECT || __DOXYGEN__ */
+
+#if LWCELL_CFG_SMS_BULK || __DOXYGEN__
+
+/**
+ * \brief           Check if `+CMS ERROR` code reports transient network condition
+ * \param[in]       err: Error code
+ * \return          `1` if send may be retried, `0` otherwise
+ */
+static uint8_t
+sms_bulk_is_transient(uint16_t err) {
+    switch (err) {
+        case 38:  /* Network out of order */
+        case 41:  /* Temporary failure */
+        case 42:  /* Congestion */
+        case 47:  /* Resources unavailable */
+        case 331: /* No network service */
+        case 332: /* Network timeout */
+            return 1;
+        default: return 0;
+    }
+}
+
+/**
+ * \brief           Send bulk SMS event to application
+ * \param[in]       job: Bulk SMS job
+ * \param[in]       done: Set to `1` to report job finished, `0` to report result of current recipient
+ */
+static void
+sms_bulk_send_evt(lwcell_sms_bulk_t* job, uint8_t done) {
+    lwcell.evt.evt.sms_bulk.job = job;
+    lwcell.evt.evt.sms_bulk.idx = job->idx;
+    lwcell.evt.evt.sms_bulk.done = done;
+    lwcell.evt.evt.sms_bulk.res = done ? lwcellOK : job->results[job->idx].res;
+    lwcell.evt.evt.sms_bulk.pos = done ? 0 : job->results[job->idx].pos;
+    lwcelli_send_cb(LWCELL_EVT_SMS_BULK);
+}
+
+/**
+ * \brief           Finish job and report all remaining recipients with the same result
+ * \param[in]       job: Bulk SMS job
+ * \param[in]       res: Result for remaining recipients
+ */
+static void
+sms_bulk_finish(lwcell_sms_bulk_t* job, lwcellr_t res) {
+    for (; job->idx < job->count; ++job->idx) {
+        job->results[job->idx].res = res;
+        sms_bulk_send_evt(job, 0);
+    }
+    job->active = 0;
+    sms_bulk_send_evt(job, 1);
+}
+
+/**
+ * \brief           Mark start of send attempt for current recipient and apply rate limit for next one
+ * \param[in]       job: Bulk SMS job
+ */
+static void
+sms_bulk_attempt(lwcell_sms_bulk_t* job) {
+    ++job->results[job->idx].tries;
+    job->next_time = lwcell_sys_now() + (job->rate > 0 ? 60000 / job->rate : 0);
+}
+
+/**
+ * \brief           Start new command for current recipient of bulk SMS job
+ * \param[in]       job: Bulk SMS job
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t otherwise
+ */
+static lwcellr_t
+sms_bulk_start_cmd(lwcell_sms_bulk_t* job) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    LWCELL_MSG_VAR_ALLOC(msg, 0);
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CMGS;
+    LWCELL_MSG_VAR_REF(msg).cmd = LWCELL_CMD_CMGF;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.num = job->nums[job->idx];
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.text = job->text;
     LWCELL_MSG_VAR_REF(msg).msg.sms_send.format = 1; /* Send as plain text */
+    LWCELL_MSG_VAR_REF(msg).msg.sms_send.bulk = job;
 
+    /* Single recipient per command, hanging modem is detected with regular timeout */
     return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 60000);
 }
 
+/**
+ * \brief           Queue command for current recipient or finish job when it cannot be queued
+ * \param[in]       job: Bulk SMS job
+ */
+static void
+sms_bulk_send_next(lwcell_sms_bulk_t* job) {
+    lwcellr_t res;
+
+    if ((res = sms_bulk_start_cmd(job)) != lwcellOK) {
+        sms_bulk_finish(job, res);
+    }
+}
+
+/**
+ * \brief           Timeout callback to continue bulk SMS job after rate limit or retry delay
+ * \param[in]       arg: Bulk SMS job
+ */
+static void
+sms_bulk_timeout_fn(void* arg) {
+    sms_bulk_send_next(arg); /* Argument is actual job */
+}
+
+/**
+ * \brief           Process sub-command of bulk SMS job
+ * \note            Called from processing thread when `AT+CMGF` or `AT+CMGS` finishes or when command fails
+ * \param[in]       msg: Bulk SMS send message
+ * \param[in]       res: Result of current sub-command
+ * \return          `1` if `AT+CMGS` shall be sent after message format is set, `0` when command finishes
+ */
+uint8_t
+lwcelli_sms_bulk_process(lwcell_msg_t* msg, lwcellr_t res) {
+    lwcell_sms_bulk_t* job = msg->msg.sms_send.bulk;
+    lwcell_sms_bulk_result_t* r = &job->results[job->idx];
+    int32_t wait;
+
+    if (msg->cmd != LWCELL_CMD_CMGS || (res != lwcellOK && res != lwcellERR)) {
+        if (res == lwcellOK) { /* Message format is set */
+            sms_bulk_attempt(job);
+            return 1;
+        }
+        sms_bulk_finish(job, res);
+        return 0;
+    }
+
+    r->cms_err = msg->msg.sms_send.cms_err;
+    msg->msg.sms_send.cms_err = 0;
+    if (res == lwcellOK) {
+        r->res = lwcellOK;
+        r->pos = msg->msg.sms_send.pos;
+    } else if (sms_bulk_is_transient(r->cms_err) && r->tries <= LWCELL_CFG_SMS_BULK_RETRIES) {
+        uint32_t retry_time = lwcell_sys_now() + (LWCELL_U32(LWCELL_CFG_SMS_BULK_BACKOFF) << (r->tries - 1));
+        if ((int32_t)(retry_time - job->next_time) > 0) {
+            job->next_time = retry_time;
+        }
+    } else {
+        r->res = lwcellERR;
+    }
+
+    /* Report recipient and move to next one */
+    if (r->res != lwcellINPROG) {
+        sms_bulk_send_evt(job, 0);
+        if (++job->idx == job->count) {
+            job->active = 0;
+            sms_bulk_send_evt(job, 1);
+            return 0;
+        }
+    }
+
+    /* Next recipient or retry is sent with new command, queued commands may run in between */
+    wait = (int32_t)(job->next_time - lwcell_sys_now());
+    if (wait <= 0) {
+        sms_bulk_send_next(job);
+    } else if (lwcell_timeout_add(LWCELL_U32(wait), sms_bulk_timeout_fn, job) != lwcellOK) {
+        sms_bulk_finish(job, lwcellERRMEM);
+    }
+    return 0;
+}
+
+/**
+ * \brief           Start bulk SMS job to send the same text to list of recipients
+ *
+ * Every recipient is sent with its own `AT+CMGS` command, next one is queued as soon as rate limit allows.
+ * Transient `+CMS ERROR` codes are retried up to \ref LWCELL_CFG_SMS_BULK_RETRIES times,
+ * with delay starting with \ref LWCELL_CFG_SMS_BULK_BACKOFF and doubled on every retry.
+ *
+ * Result of every recipient and job completion are reported with \ref LWCELL_EVT_SMS_BULK event,
+ * results are also written to `results` array.
+ *
+ * \note            Function is always non-blocking. Job, numbers, results and text memory
+ *                      must stay valid until job finishes
+ * \param[out]      job: Job structure, must not be in progress
+ * \param[in]       nums: Array of recipient numbers
+ * \param[out]      results: Array of results, one for each recipient
+ * \param[in]       count: Number of recipients
+ * \param[in]       text: Text to send. Maximal `160` characters
+ * \param[in]       rate: Maximal number of messages per minute, `0` for no limit
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_sms_bulk_start(lwcell_sms_bulk_t* job, const char* const* nums, lwcell_sms_bulk_result_t* results,
+                      size_t count, const char* text, uint32_t rate) {
+    lwcellr_t res;
+
+    LWCELL_ASSERT(job != NULL);
+    LWCELL_ASSERT(nums != NULL && results != NULL && count > 0);
+    LWCELL_ASSERT(text != NULL && text[0] > 0 && strlen(text) <= 160);
+    for (size_t i = 0; i < count; ++i) {
+        LWCELL_ASSERT(nums[i] != NULL && nums[i][0] > 0);
+    }
+    CHECK_ENABLED(); /* Check if enabled */
+    CHECK_READY();   /* Check if ready */
+
+    LWCELL_MEMSET(job, 0x00, sizeof(*job));
+    LWCELL_MEMSET(results, 0x00, sizeof(*results) * count);
+    for (size_t i = 0; i < count; ++i) {
+        results[i].res = lwcellINPROG;
+    }
+    job->nums = nums;
+    job->results = results;
+    job->count = count;
+    job->text = text;
+    job->rate = rate;
+
+    lwcell_core_lock();
+    job->active = 1;
+    if ((res = sms_bulk_start_cmd(job)) != lwcellOK) {
+        job->active = 0;
+    }
+    lwcell_core_unlock();
+    return res;
+}
+
+#endif /* LWCELL_CFG_SMS_BULK || __DOXYGEN__ */
+
 /**
  * \brief           Read SMS entry at specific memory and position
  * \param[in]       mem: Memory used to read message from
@@ -201,7 +608,11 @@ lwcell_sms_read(lwcell_mem_t mem, size_t pos, lwcell_sms_entry_t* entry, uint8_t
     LWCELL_MSG_VAR_REF(msg).msg.sms_read.pos = pos;
     LWCELL_MSG_VAR_REF(msg).msg.sms_read.entry = entry;
     LWCELL_MSG_VAR_REF(msg).msg.sms_read.update = update;
-    LWCELL_MSG_VAR_REF(msg).msg.sms_read.format = 1; /* Send as plain text */
+#if LWCELL_CFG_SMS_PDU
+    LWCELL_MSG_VAR_REF(msg).msg.sms_read.format = 0; /* Read in PDU mode and decode */
+#else  /* LWCELL_CFG_SMS_PDU */
+    LWCELL_MSG_VAR_REF(msg).msg.sms_read.format = 1; /* Read as plain text */
+#endif /* !LWCELL_CFG_SMS_PDU */
 
     return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 60000);
 }
@@ -307,7 +718,74 @@ lwcell_sms_list(lwcell_mem_t mem, lwcell_sms_status_t stat, lwcell_sms_entry_t*
     LWCELL_MSG_VAR_REF(msg).msg.sms_list.etr = etr;
     LWCELL_MSG_VAR_REF(msg).msg.sms_list.er = er;
     LWCELL_MSG_VAR_REF(msg).msg.sms_list.update = update;
-    LWCELL_MSG_VAR_REF(msg).msg.sms_list.format = 1; /* Send as plain text */
+#if LWCELL_CFG_SMS_PDU
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.format = 0; /* Read in PDU mode and decode */
+#else  /* LWCELL_CFG_SMS_PDU */
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.format = 1; /* Read as plain text */
+#endif /* !LWCELL_CFG_SMS_PDU */
+
+    return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 60000);
+}
+
+/**
+ * \brief           List SMS from SMS memory and report every entry to callback function
+ *
+ * Entries are parsed to single scratch entry and reported as soon as their data line is received,
+ * so memory use does not depend on number of messages in storage.
+ * Callback may ignore entries to filter them or return `0` to stop listing.
+ * Device still reports remaining entries, which are skipped by the stack.
+ *
+ * \note            Callback is called from processing thread and must not call blocking API functions
+ * \param[in]       mem: Memory to read entries from. Use \ref LWCELL_MEM_CURRENT to read from current memory
+ * \param[in]       stat: SMS status to read, either `read`, `unread`, `sent`, `unsent` or `all`
+ * \param[in]       entry: Scratch entry used to parse each message. It must stay valid until command finishes
+ * \param[in]       fn: Callback function called for every parsed entry
+ * \param[in]       fn_arg: Custom argument for entry callback function
+ * \param[out]      er: Pointer to output variable to save number of reported entries. Set to `NULL` if not used
+ * \param[in]       update: Flag indicates update. Set to `1` to change `UNREAD` messages to `READ` or `0` to leave as is
+ * \param[in]       evt_fn: Callback function called when command has finished. Set to `NULL` when not used
+ * \param[in]       evt_arg: Custom argument for event callback function
+ * \param[in]       blocking: Status whether command should be blocking or not
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t otherwise
+ */
+lwcellr_t
+lwcell_sms_list_stream(lwcell_mem_t mem, lwcell_sms_status_t stat, lwcell_sms_entry_t* entry, lwcell_sms_list_fn fn,
+                       void* fn_arg, size_t* er, uint8_t update, const lwcell_api_cmd_evt_fn evt_fn,
+                       void* const evt_arg, const uint32_t blocking) {
+    LWCELL_MSG_VAR_DEFINE(msg);
+
+    LWCELL_ASSERT(entry != NULL);
+    LWCELL_ASSERT(fn != NULL);
+    CHECK_ENABLED(); /* Check if enabled */
+    CHECK_READY();   /* Check if ready */
+    LWCELL_ASSERT(check_sms_mem(mem, 1) == lwcellOK);
+
+    LWCELL_MSG_VAR_ALLOC(msg, blocking);
+    LWCELL_MSG_VAR_SET_EVT(msg, evt_fn, evt_arg);
+
+    if (er != NULL) {
+        *er = 0;
+    }
+    LWCELL_MEMSET(entry, 0x00, sizeof(*entry));
+    LWCELL_MSG_VAR_REF(msg).cmd_def = LWCELL_CMD_CMGL;
+    if (mem == LWCELL_MEM_CURRENT) {                       /* Should be always false */
+        LWCELL_MSG_VAR_REF(msg).cmd = LWCELL_CMD_CPMS_GET; /* First get memory */
+    } else {
+        LWCELL_MSG_VAR_REF(msg).cmd = LWCELL_CMD_CPMS_SET; /* First set memory */
+    }
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.mem = mem;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.status = stat;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.entries = entry;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.etr = SIZE_MAX; /* No limit, entry is reused */
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.er = er;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.update = update;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.fn = fn;
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.fn_arg = fn_arg;
+#if LWCELL_CFG_SMS_PDU
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.format = 0; /* Read in PDU mode and decode */
+#else  /* LWCELL_CFG_SMS_PDU */
+    LWCELL_MSG_VAR_REF(msg).msg.sms_list.format = 1; /* Read as plain text */
+#endif /* !LWCELL_CFG_SMS_PDU */
 
     return lwcelli_send_msg_to_producer_mbox(&LWCELL_MSG_VAR_REF(msg), lwcelli_initiate_cmd, 60000);
 }
@@ -0,0 +1,688 @@
+/**
+ * \file            lwcell_sms_pdu.c
+ * \brief           SMS PDU encoder and decoder
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwCELL - Lightweight cellular modem AT library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v0.1.1
+ */
+#include "lwcell/lwcell_sms.h"
+#include "lwcell/lwcell_private.h"
+
+#if LWCELL_CFG_SMS_PDU || __DOXYGEN__
+
+#define SMS_UD_MAX_LEN     140  /*!< Maximal length of user data in units of bytes */
+#define SMS_UDH_CONCAT_LEN 6    /*!< Length of user data header with 8-bit reference concatenation element */
+#define SMS_GSM7_ESC       0x1B /*!< GSM 7-bit escape to extension table */
+
+/**
+ * \brief           GSM 7-bit default alphabet to unicode table
+ */
+static const uint16_t sms_gsm7_basic[128] = {
+    0x0040, 0x00A3, 0x0024, 0x00A5, 0x00E8, 0x00E9, 0x00F9, 0x00EC, 0x00F2, 0x00C7, 0x000A, 0x00D8, 0x00F8,
+    0x000D, 0x00C5, 0x00E5, 0x0394, 0x005F, 0x03A6, 0x0393, 0x039B, 0x03A9, 0x03A0, 0x03A8, 0x03A3, 0x0398,
+    0x039E, 0x00A0, 0x00C6, 0x00E6, 0x00DF, 0x00C9, 0x0020, 0x0021, 0x0022, 0x0023, 0x00A4, 0x0025, 0x0026,
+    0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033,
+    0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x00A1,
+    0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D,
+    0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A,
+    0x00C4, 0x00D6, 0x00D1, 0x00DC, 0x00A7, 0x00BF, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074,
+    0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00E4, 0x00F6, 0x00F1, 0x00FC, 0x00E0,
+};
+
+/**
+ * \brief           GSM 7-bit extension table, pairs of septet and unicode values
+ */
+static const uint16_t sms_gsm7_ext[][2] = {
+    {0x0A, 0x000C}, {0x14, 0x005E}, {0x28, 0x007B}, {0x29, 0x007D}, {0x2F, 0x005C},
+    {0x3C, 0x005B}, {0x3D, 0x007E}, {0x3E, 0x005D}, {0x40, 0x007C}, {0x65, 0x20AC},
+};
+
+/**
+ * \brief           Get next unicode code point from UTF-8 input
+ * \param[in]       d: Input data
+ * \param[in]       len: Length of input data
+ * \param[out]      cp: Output code point
+ * \return          Number of input bytes used for code point, `0` on invalid sequence
+ */
+static size_t
+sms_utf8_get(const uint8_t* d, size_t len, uint32_t* cp) {
+    size_t n;
+
+    if (d[0] < 0x80) {
+        *cp = d[0];
+        return 1;
+    } else if ((d[0] & 0xE0) == 0xC0) {
+        n = 2;
+        *cp = d[0] & 0x1F;
+    } else if ((d[0] & 0xF0) == 0xE0) {
+        n = 3;
+        *cp = d[0] & 0x0F;
+    } else if ((d[0] & 0xF8) == 0xF0) {
+        n = 4;
+        *cp = d[0] & 0x07;
+    } else {
+        return 0;
+    }
+    if (n > len) {
+        return 0;
+    }
+    for (size_t i = 1; i < n; ++i) {
+        if ((d[i] & 0xC0) != 0x80) {
+            return 0;
+        }
+        *cp = (*cp << 6) | (d[i] & 0x3F);
+    }
+    return n;
+}
+
+/**
+ * \brief           Write unicode code point in UTF-8 format to output buffer
+ * \param[out]      out: Output buffer
+ * \param[in]       size: Size of output buffer
+ * \param[in,out]   pos: Current write position in output buffer
+ * \param[in]       cp: Code point to write
+ * \return          `1` on success, `0` if there is no memory for entire sequence
+ */
+static uint8_t
+sms_utf8_put(uint8_t* out, size_t size, size_t* pos, uint32_t cp) {
+    uint8_t tmp[4];
+    size_t n;
+
+    if (cp < 0x80) {
+        tmp[0] = (uint8_t)cp;
+        n = 1;
+    } else if (cp < 0x800) {
+        tmp[0] = (uint8_t)(0xC0 | (cp >> 6));
+        tmp[1] = (uint8_t)(0x80 | (cp & 0x3F));
+        n = 2;
+    } else if (cp < 0x10000) {
+        tmp[0] = (uint8_t)(0xE0 | (cp >> 12));
+        tmp[1] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+        tmp[2] = (uint8_t)(0x80 | (cp & 0x3F));
+        n = 3;
+    } else {
+        tmp[0] = (uint8_t)(0xF0 | (cp >> 18));
+        tmp[1] = (uint8_t)(0x80 | ((cp >> 12) & 0x3F));
+        tmp[2] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+        tmp[3] = (uint8_t)(0x80 | (cp & 0x3F));
+        n = 4;
+    }
+    if (*pos + n > size) {
+        return 0;
+    }
+    LWCELL_MEMCPY(&out[*pos], tmp, n);
+    *pos += n;
+    return 1;
+}
+
+/**
+ * \brief           Find GSM 7-bit representation of unicode code point
+ * \param[in]       cp: Code point to find
+ * \param[out]      code: Output septets, escape septet is written first for extension table characters
+ * \return          Number of septets, `0` if character cannot be represented in GSM 7-bit alphabet
+ */
+static size_t
+sms_gsm7_find(uint32_t cp, uint8_t* code) {
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(sms_gsm7_basic); ++i) {
+        if (sms_gsm7_basic[i] == cp && i != SMS_GSM7_ESC) {
+            code[0] = (uint8_t)i;
+            return 1;
+        }
+    }
+    for (size_t i = 0; i < LWCELL_ARRAYSIZE(sms_gsm7_ext); ++i) {
+        if (sms_gsm7_ext[i][1] == cp) {
+            code[0] = SMS_GSM7_ESC;
+            code[1] = (uint8_t)sms_gsm7_ext[i][0];
+            return 2;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Convert GSM 7-bit septet to unicode code point
+ * \param[in]       code: Septet value
+ * \param[in]       ext: Set to `1` if previous septet was escape to extension table
+ * \return          Unicode code point
+ */
+static uint32_t
+sms_gsm7_to_unicode(uint8_t code, uint8_t ext) {
+    if (ext) {
+        for (size_t i = 0; i < LWCELL_ARRAYSIZE(sms_gsm7_ext); ++i) {
+            if (sms_gsm7_ext[i][0] == code) {
+                return sms_gsm7_ext[i][1];
+            }
+        }
+    }
+    return sms_gsm7_basic[code & 0x7F]; /* Unknown extension is displayed as default alphabet character */
+}
+
+/**
+ * \brief           Write septet to packed GSM 7-bit user data
+ * \note            User data must be zeroed before first write
+ * \param[out]      ud: User data
+ * \param[in]       idx: Septet index in user data, including header septets
+ * \param[in]       code: Septet value
+ */
+static void
+sms_gsm7_put(uint8_t* ud, size_t idx, uint8_t code) {
+    size_t bit = idx * 7;
+    uint8_t shift = (uint8_t)(bit & 0x07);
+
+    ud[bit >> 3] |= (uint8_t)(code << shift);
+    if (shift > 1) {
+        ud[(bit >> 3) + 1] |= (uint8_t)(code >> (8 - shift));
+    }
+}
+
+/**
+ * \brief           Read septet from packed GSM 7-bit user data
+ * \param[in]       ud: User data
+ * \param[in]       idx: Septet index in user data, including header septets
+ * \return          Septet value
+ */
+static uint8_t
+sms_gsm7_get(const uint8_t* ud, size_t idx) {
+    size_t bit = idx * 7;
+    uint8_t shift = (uint8_t)(bit & 0x07);
+    uint8_t code;
+
+    code = (uint8_t)(ud[bit >> 3] >> shift);
+    if (shift > 1) {
+        code |= (uint8_t)(ud[(bit >> 3) + 1] << (8 - shift));
+    }
+    return (uint8_t)(code & 0x7F);
+}
+
+/**
+ * \brief           Decode packed GSM 7-bit septets to UTF-8 output
+ * \param[in]       ud: Packed user data
+ * \param[in]       start: Index of first septet to decode
+ * \param[in]       end: Index of last septet to decode, exclusive
+ * \param[out]      out: Output buffer
+ * \param[in]       size: Size of output buffer
+ * \return          Number of bytes written to output buffer
+ */
+static size_t
+sms_gsm7_decode(const uint8_t* ud, size_t start, size_t end, uint8_t* out, size_t size) {
+    size_t pos = 0;
+    uint8_t ext = 0;
+
+    for (size_t i = start; i < end; ++i) {
+        uint8_t code = sms_gsm7_get(ud, i);
+        if (code == SMS_GSM7_ESC && !ext) {
+            ext = 1;
+            continue;
+        }
+        if (!sms_utf8_put(out, size, &pos, sms_gsm7_to_unicode(code, ext))) {
+            break;
+        }
+        ext = 0;
+    }
+    return pos;
+}
+
+/**
+ * \brief           Decode semi-octet value, as used in time stamp
+ * \param[in]       b: Byte with swapped BCD digits
+ * \return          Decoded value
+ */
+static int
+sms_semi_octet(uint8_t b) {
+    return (b & 0x0F) * 10 + ((b >> 4) & 0x0F);
+}
+
+/**
+ * \brief           Decode address field to string
+ * \param[in]       d: Address value, after length and type fields
+ * \param[in]       digits: Length of address in semi-octets
+ * \param[in]       toa: Type of address
+ * \param[out]      out: Output string
+ * \param[in]       size: Size of output string, including `NULL` termination
+ */
+static void
+sms_addr_decode(const uint8_t* d, size_t digits, uint8_t toa, char* out, size_t size) {
+    static const char bcd[] = "0123456789*#abc";
+    size_t pos = 0;
+
+    if ((toa & 0x70) == 0x50) { /* Alphanumeric address in GSM 7-bit alphabet */
+        pos = sms_gsm7_decode(d, 0, digits * 4 / 7, (uint8_t*)out, size - 1);
+    } else {
+        if ((toa & 0x70) == 0x10 && pos < size - 1) { /* International number */
+            out[pos++] = '+';
+        }
+        for (size_t i = 0; i < digits && pos < size - 1; ++i) {
+            uint8_t nibble = (uint8_t)((i & 0x01) ? (d[i >> 1] >> 4) : (d[i >> 1] & 0x0F));
+            if (nibble == 0x0F) {
+                break;
+            }
+            out[pos++] = bcd[nibble];
+        }
+    }
+    out[pos] = 0;
+}
+
+/**
+ * \brief           Get number of input bytes, that fit to single message
+ * \param[in]       data: Data to send. For \ref LWCELL_SMS_CODING_GSM7 and \ref LWCELL_SMS_CODING_UCS2
+ *                      codings, data are text in UTF-8 format
+ * \param[in]       len: Length of data in units of bytes
+ * \param[in]       coding: User data coding
+ * \param[in]       concat: Set to `1` if message includes concatenation header
+ * \param[out]      units: Number of user data units (septets for GSM 7-bit, bytes otherwise) for used input
+ * \return          Number of input bytes that fit to message, `0` if data cannot be encoded with selected coding
+ */
+size_t
+lwcelli_sms_pdu_segment(const void* data, size_t len, lwcell_sms_coding_t coding, uint8_t concat, size_t* units) {
+    const uint8_t* d = data;
+    size_t max, pos = 0, u = 0, n, cnt;
+    uint32_t cp;
+    uint8_t code[2];
+
+    max = SMS_UD_MAX_LEN - (concat ? SMS_UDH_CONCAT_LEN : 0);
+    if (coding == LWCELL_SMS_CODING_8BIT) {
+        *units = LWCELL_MIN(len, max);
+        return *units;
+    } else if (coding == LWCELL_SMS_CODING_GSM7) {
+        max = max * 8 / 7; /* Number of septets */
+    }
+    while (pos < len) {
+        if ((n = sms_utf8_get(&d[pos], len - pos, &cp)) == 0) {
+            return 0;
+        }
+        if (coding == LWCELL_SMS_CODING_GSM7) {
+            cnt = sms_gsm7_find(cp, code);
+        } else {
+            cnt = (cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF ? 0 : (cp > 0xFFFF ? 4 : 2);
+        }
+        if (cnt == 0) {
+            return 0;
+        }
+        if (u + cnt > max) { /* Character must not be split between messages */
+            break;
+        }
+        u += cnt;
+        pos += n;
+    }
+    *units = u;
+    return pos;
+}
+
+/**
+ * \brief           Encode `SMS-SUBMIT` PDU for single message
+ *
+ * Encodes as much data as fits to one message. Service center address from device configuration is used.
+ *
+ * \param[out]      pdu: Output buffer of \ref LWCELL_SMS_PDU_MAX_LEN bytes
+ * \param[in]       num: Destination number, optionally with leading `+` for international format
+ * \param[in]       data: Data to encode, see \ref lwcelli_sms_pdu_segment
+ * \param[in]       len: Length of data in units of bytes
+ * \param[in]       coding: User data coding
+ * \param[in]       ref: Concatenated message reference number
+ * \param[in]       total: Number of parts of concatenated message. Set to `1` for single message
+ * \param[in]       seq: Sequence number of this part, starting with `1`
+ * \param[out]      used: Number of input bytes encoded to this message
+ * \return          Length of PDU including service center address field, `0` on failure
+ */
+size_t
+lwcelli_sms_pdu_encode(uint8_t* pdu, const char* num, const void* data, size_t len, lwcell_sms_coding_t coding,
+                       uint8_t ref, uint8_t total, uint8_t seq, size_t* used) {
+    const uint8_t* d = data;
+    size_t i = 0, ud, udl_idx, hdr = 0, units, digits;
+    uint8_t concat = total > 1, toa = 0x81;
+
+    if ((*used = lwcelli_sms_pdu_segment(data, len, coding, concat, &units)) == 0) {
+        return 0;
+    }
+
+    pdu[i++] = 0x00;                                   /* Use service center stored in device */
+    pdu[i++] = (uint8_t)(0x01 | (concat ? 0x40 : 0x00)); /* SMS-SUBMIT, user data header indication */
+    pdu[i++] = 0x00;                                   /* Message reference is set by device */
+
+    /* Destination address */
+    if (*num == '+') {
+        toa = 0x91;
+        ++num;
+    }
+    digits = strlen(num);
+    if (digits == 0 || digits > 20) {
+        return 0;
+    }
+    pdu[i++] = (uint8_t)digits;
+    pdu[i++] = toa;
+    for (size_t k = 0; k < digits; ++k) {
+        uint8_t nibble;
+        if (num[k] >= '0' && num[k] <= '9') {
+            nibble = (uint8_t)(num[k] - '0');
+        } else if (num[k] == '*') {
+            nibble = 0x0A;
+        } else if (num[k] == '#') {
+            nibble = 0x0B;
+        } else {
+            return 0;
+        }
+        if (k & 0x01) {
+            pdu[i] = (uint8_t)((pdu[i] & 0x0F) | (nibble << 4));
+            ++i;
+        } else {
+            pdu[i] = (uint8_t)(0xF0 | nibble); /* Filler for odd number of digits */
+        }
+    }
+    if (digits & 0x01) {
+        ++i;
+    }
+
+    pdu[i++] = 0x00; /* Protocol identifier */
+    pdu[i++] = coding == LWCELL_SMS_CODING_UCS2 ? 0x08 : (coding == LWCELL_SMS_CODING_8BIT ? 0x04 : 0x00);
+    udl_idx = i++;
+    ud = i;
+
+    /* Concatenation information element with 8-bit reference */
+    if (concat) {
+        pdu[i++] = SMS_UDH_CONCAT_LEN - 1;
+        pdu[i++] = 0x00;
+        pdu[i++] = 0x03;
+        pdu[i++] = ref;
+        pdu[i++] = total;
+        pdu[i++] = seq;
+        hdr = SMS_UDH_CONCAT_LEN;
+    }
+
+    if (coding == LWCELL_SMS_CODING_GSM7) {
+        size_t hdr_septets = (hdr * 8 + 6) / 7, septet = hdr_septets, bytes;
+
+        bytes = ((hdr_septets + units) * 7 + 7) / 8;
+        LWCELL_MEMSET(&pdu[i], 0x00, bytes - hdr);
+        for (size_t pos = 0, n; pos < *used; pos += n) {
+            uint32_t cp;
+            uint8_t code[2];
+            size_t cnt;
+
+            n = sms_utf8_get(&d[pos], *used - pos, &cp);
+            cnt = sms_gsm7_find(cp, code);
+            for (size_t k = 0; k < cnt; ++k) {
+                sms_gsm7_put(&pdu[ud], septet++, code[k]);
+            }
+        }
+        pdu[udl_idx] = (uint8_t)(hdr_septets + units);
+        i = ud + bytes;
+    } else if (coding == LWCELL_SMS_CODING_UCS2) {
+        for (size_t pos = 0, n; pos < *used; pos += n) {
+            uint32_t cp;
+
+            n = sms_utf8_get(&d[pos], *used - pos, &cp);
+            if (cp > 0xFFFF) { /* Surrogate pair */
+                cp -= 0x10000;
+                pdu[i++] = (uint8_t)(0xD8 | ((cp >> 18) & 0x03));
+                pdu[i++] = (uint8_t)(cp >> 10);
+                cp = 0xDC00 | (cp & 0x3FF);
+            }
+            pdu[i++] = (uint8_t)(cp >> 8);
+            pdu[i++] = (uint8_t)cp;
+        }
+        pdu[udl_idx] = (uint8_t)(hdr + units);
+    } else {
+        LWCELL_MEMCPY(&pdu[i], d, *used);
+        i += *used;
+        pdu[udl_idx] = (uint8_t)(hdr + units);
+    }
+    return i;
+}
+
+/**
+ * \brief           Decode `SMS-DELIVER` or `SMS-SUBMIT` PDU
+ *
+ * Text messages (GSM 7-bit and UCS2 coding) are converted to UTF-8 format,
+ * 8-bit data are copied as received. Output is always `NULL` terminated
+ * and truncated if it does not fit to output buffer.
+ *
+ * \param[in]       pdu: PDU in binary format
+ * \param[in]       len: Length of PDU in units of bytes
+ * \param[in]       has_smsc: Set to `1` if PDU starts with service center address, as reported by device
+ * \param[out]      info: Decoded message information
+ * \param[out]      data: Output buffer for decoded user data
+ * \param[in]       data_size: Size of output buffer, including memory for `NULL` termination
+ * \param[out]      data_len: Optional output for number of bytes written to output buffer.
+ *                      Set to `NULL` if not used
+ * \return          \ref lwcellOK on success, member of \ref lwcellr_t enumeration otherwise
+ */
+lwcellr_t
+lwcell_sms_pdu_decode(const void* pdu, size_t len, uint8_t has_smsc, lwcell_sms_pdu_t* info, void* data,
+                      size_t data_size, size_t* data_len) {
+    const uint8_t *p = pdu, *ud;
+    uint8_t* out = data;
+    size_t i = 0, pos = 0, hdr = 0, udl, ud_len, digits;
+    uint8_t fo, toa, dcs;
+
+    LWCELL_ASSERT(pdu != NULL);
+    LWCELL_ASSERT(info != NULL);
+    LWCELL_ASSERT(data != NULL);
+    LWCELL_ASSERT(data_size > 0);
+
+    LWCELL_MEMSET(info, 0x00, sizeof(*info));
+    if (has_smsc) {
+        if (len < 1) {
+            return lwcellERR;
+        }
+        i += 1 + p[0];
+    }
+    if (i + 1 > len) {
+        return lwcellERR;
+    }
+    fo = p[i++];
+    if ((fo & 0x03) == 0x01) { /* SMS-SUBMIT includes message reference */
+        info->is_submit = 1;
+        ++i;
+    } else if ((fo & 0x03) != 0x00) {
+        return lwcellERR; /* Status reports and commands are not supported */
+    }
+
+    /* Originating or destination address */
+    if (i + 2 > len) {
+        return lwcellERR;
+    }
+    digits = p[i++];
+    toa = p[i++];
+    if (i + (digits + 1) / 2 + 2 > len) {
+        return lwcellERR;
+    }
+    sms_addr_decode(&p[i], digits, toa, info->number, sizeof(info->number));
+    i += (digits + 1) / 2;
+    ++i; /* Protocol identifier */
+    dcs = p[i++];
+
+    if (!info->is_submit) { /* Service center time stamp */
+        if (i + 7 > len) {
+            return lwcellERR;
+        }
+        info->dt.tm_year = 100 + sms_semi_octet(p[i]);
+        info->dt.tm_mon = sms_semi_octet(p[i + 1]) - 1;
+        info->dt.tm_mday = sms_semi_octet(p[i + 2]);
+        info->dt.tm_hour = sms_semi_octet(p[i + 3]);
+        info->dt.tm_min = sms_semi_octet(p[i + 4]);
+        info->dt.tm_sec = sms_semi_octet(p[i + 5]);
+        i += 7;
+    } else {
+        switch ((fo >> 3) & 0x03) { /* Validity period format */
+            case 0x02: i += 1; break;
+            case 0x01:
+            case 0x03: i += 7; break;
+            default: break;
+        }
+    }
+
+    /* Data coding scheme */
+    if ((dcs & 0x80) == 0x00) {
+        switch ((dcs >> 2) & 0x03) {
+            case 0x01: info->coding = LWCELL_SMS_CODING_8BIT; break;
+            case 0x02: info->coding = LWCELL_SMS_CODING_UCS2; break;
+            default: info->coding = LWCELL_SMS_CODING_GSM7; break;
+        }
+    } else if ((dcs & 0xF0) == 0xF0) {
+        info->coding = (dcs & 0x04) ? LWCELL_SMS_CODING_8BIT : LWCELL_SMS_CODING_GSM7;
+    } else if ((dcs & 0xF0) == 0xE0) {
+        info->coding = LWCELL_SMS_CODING_UCS2;
+    } else {
+        info->coding = LWCELL_SMS_CODING_GSM7;
+    }
+
+    /* User data */
+    if (i + 1 > len) {
+        return lwcellERR;
+    }
+    udl = p[i++];
+    ud = &p[i];
+    ud_len = info->coding == LWCELL_SMS_CODING_GSM7 ? (udl * 7 + 7) / 8 : udl;
+    if (i + ud_len > len || ud_len > SMS_UD_MAX_LEN) {
+        return lwcellERR;
+    }
+    if (fo & 0x40) { /* User data header */
+        if (ud_len < 1 || (hdr = (size_t)ud[0] + 1) > ud_len) {
+            return lwcellERR;
+        }
+        for (size_t k = 1; k + 1 < hdr && k + 2 + ud[k + 1] <= hdr; k += 2 + ud[k + 1]) {
+            if (ud[k] == 0x00 && ud[k + 1] == 3) { /* Concatenation with 8-bit reference */
+                info->concat_ref = ud[k + 2];
+                info->concat_total = ud[k + 3];
+                info->concat_seq = ud[k + 4];
+            } else if (ud[k] == 0x08 && ud[k + 1] == 4) { /* Concatenation with 16-bit reference */
+                info->concat_ref = (uint16_t)((ud[k + 2] << 8) | ud[k + 3]);
+                info->concat_total = ud[k + 4];
+                info->concat_seq = ud[k + 5];
+            }
+        }
+    }
+
+    --data_size; /* Keep memory for NULL termination */
+    if (info->coding == LWCELL_SMS_CODING_GSM7) {
+        pos = sms_gsm7_decode(ud, (hdr * 8 + 6) / 7, udl, out, data_size);
+    } else if (info->coding == LWCELL_SMS_CODING_UCS2) {
+        for (size_t k = hdr; k + 1 < udl; k += 2) {
+            uint32_t cp = (uint32_t)((ud[k] << 8) | ud[k + 1]);
+            if (cp >= 0xD800 && cp <= 0xDBFF && k + 3 < udl) { /* Surrogate pair */
+                uint32_t lo = (uint32_t)((ud[k + 2] << 8) | ud[k + 3]);
+                if (lo >= 0xDC00 && lo <= 0xDFFF) {
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                    k += 2;
+                }
+            }
+            if (cp >= 0xD800 && cp <= 0xDFFF) {
+                cp = '?'; /* Unpaired surrogate */
+            }
+            if (!sms_utf8_put(out, data_size, &pos, cp)) {
+                break;
+            }
+        }
+    } else if (udl > hdr) {
+        pos = LWCELL_MIN(udl - hdr, data_size);
+        LWCELL_MEMCPY(out, &ud[hdr], pos);
+    }
+    out[pos] = 0;
+    if (data_len != NULL) {
+        *data_len = pos;
+    }
+    return lwcellOK;
+}
+
+/**
+ * \brief           Initialize concatenated message reassembly structure
+ * \param[out]      c: Reassembly structure to initialize
+ * \param[in]       buff: Buffer for message data. It must be at least
+ *                      `LWCELL_CFG_SMS_CONCAT_MAX_PARTS * part_size` bytes long
+ * \param[in]       part_size: Maximal length of data of one part
+ */
+void
+lwcell_sms_concat_init(lwcell_sms_concat_t* c, void* buff, size_t part_size) {
+    LWCELL_MEMSET(c, 0x00, sizeof(*c));
+    c->buff = buff;
+    c->part_size = part_size;
+}
+
+/**
+ * \brief           Add received part of concatenated message
+ *
+ * Parts may be added in any order. Message in progress is dropped
+ * when part of another message (different sender, reference or number of parts) is added.
+ *
+ * \param[in,out]   c: Reassembly structure
+ * \param[in]       info: Decoded part information, as returned by \ref lwcell_sms_pdu_decode
+ * \param[in]       data: Decoded part data
+ * \param[in]       len: Length of part data in units of bytes
+ * \return          \ref lwcellOK when message is complete and available in buffer with `len` bytes,
+ *                  \ref lwcellINPROG when more parts are expected,
+ *                  \ref lwcellERRPAR if message is not concatenated or part information is not valid,
+ *                  \ref lwcellERRMEM if part does not fit to reassembly buffer
+ */
+lwcellr_t
+lwcell_sms_concat_add(lwcell_sms_concat_t* c, const lwcell_sms_pdu_t* info, const void* data, size_t len) {
+    size_t off = 0;
+
+    LWCELL_ASSERT(c != NULL && c->buff != NULL);
+    LWCELL_ASSERT(info != NULL);
+    LWCELL_ASSERT(data != NULL || len == 0);
+
+    if (info->concat_total == 0 || info->concat_seq == 0 || info->concat_seq > info->concat_total) {
+        return lwcellERRPAR;
+    }
+    if (info->concat_total > LWCELL_CFG_SMS_CONCAT_MAX_PARTS || len > c->part_size) {
+        return lwcellERRMEM;
+    }
+
+    /* Start new message */
+    if (c->total == 0 || c->ref != info->concat_ref || c->total != info->concat_total
+        || strcmp(c->number, info->number)) {
+        c->ref = info->concat_ref;
+        c->total = info->concat_total;
+        c->received = 0;
+        c->len = 0;
+        strncpy(c->number, info->number, sizeof(c->number) - 1);
+        c->number[sizeof(c->number) - 1] = 0;
+    }
+    if (c->received & (1UL << (info->concat_seq - 1))) {
+        return lwcellINPROG; /* Duplicate part */
+    }
+    LWCELL_MEMCPY(&c->buff[(info->concat_seq - 1) * c->part_size], data, len);
+    c->part_len[info->concat_seq - 1] = len;
+    c->received |= 1UL << (info->concat_seq - 1);
+    if (c->received != (0xFFFFFFFFUL >> (32 - c->total))) {
+        return lwcellINPROG;
+    }
+
+    /* Move parts to contiguous memory, each part moves towards buffer start */
+    for (size_t i = 0; i < c->total; ++i) {
+        memmove(&c->buff[off], &c->buff[i * c->part_size], c->part_len[i]);
+        off += c->part_len[i];
+    }
+    c->len = off;
+    c->total = 0; /* Ready for next message */
+    return lwcellOK;
+}
+
+#endif /* LWCELL_CFG_SMS_PDU || __DOXYGEN__ */
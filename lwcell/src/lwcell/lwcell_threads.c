@@ -38,6 +38,87 @@
 #include "lwcell/lwcell_timeout.h"
 #include "system/lwcell_sys.h"
 
+#if LWCELL_CFG_CMD_LATENCY || __DOXYGEN__
+
+/**
+ * \brief           Check if command is comparable with recorded latency samples of its type
+ *
+ * Commands with deadline, commands marked to skip latency and commands with fixed timeout
+ * other than the one samples were recorded with (scaled with amount of work) are not comparable
+ *
+ * \param[in]       msg: Message to check
+ * \param[in]       budget: Fixed timeout of command, set by API function
+ * \return          `1` if comparable, `0` otherwise
+ */
+static uint8_t
+cmd_latency_match(lwcell_msg_t* msg, uint32_t budget) {
+    lwcell_cmd_latency_t* l = &lwcell.cmd_latency[msg->cmd_def];
+
+#if LWCELL_CFG_CMD_HANDLE
+    if (msg->deadline) {
+        return 0;
+    }
+#endif /* LWCELL_CFG_CMD_HANDLE */
+    return !msg->lat_skip && (l->cnt == 0 || l->budget == budget);
+}
+
+/**
+ * \brief           Record completion latency of command
+ *
+ * Estimate is moved up by `p` and down by `100 - p` parts of a step, proportional to estimate itself,
+ * so it settles where `p` percent of samples are lower, `p` being \ref LWCELL_CFG_CMD_LATENCY_PERCENTILE.
+ *
+ * \param[in]       cmd: Command type
+ * \param[in]       budget: Fixed timeout of command, set by API function
+ * \param[in]       ms: Latency in units of milliseconds
+ */
+static void
+cmd_latency_record(lwcell_cmd_t cmd, uint32_t budget, uint32_t ms) {
+    lwcell_cmd_latency_t* l = &lwcell.cmd_latency[cmd];
+    uint32_t step, d;
+
+    if (l->cnt == 0) {
+        l->est = ms;
+        l->budget = budget;
+    } else {
+        step = LWCELL_MAX(l->est / 16, 1);
+        if (ms > l->est) {
+            d = (step * LWCELL_CFG_CMD_LATENCY_PERCENTILE + 99) / 100;
+            l->est += d;
+        } else if (ms < l->est) {
+            d = (step * (100 - LWCELL_CFG_CMD_LATENCY_PERCENTILE) + 99) / 100;
+            l->est = l->est > d ? l->est - d : 0;
+        }
+    }
+    if (l->cnt < UINT16_MAX) {
+        ++l->cnt;
+    }
+}
+
+#if LWCELL_CFG_CMD_TIMEOUT_ADAPT || __DOXYGEN__
+
+/**
+ * \brief           Get command timeout derived from its latency estimate
+ * \param[in]       msg: Message to execute
+ * \return          Timeout in units of milliseconds
+ */
+static uint32_t
+cmd_latency_timeout(lwcell_msg_t* msg) {
+    lwcell_cmd_latency_t* l = &lwcell.cmd_latency[msg->cmd_def];
+
+    if (!cmd_latency_match(msg, msg->block_time) || l->cnt < LWCELL_CFG_CMD_TIMEOUT_ADAPT_SAMPLES) {
+        return msg->block_time;
+    }
+    if (l->est > LWCELL_CFG_CMD_TIMEOUT_ADAPT_MAX / LWCELL_CFG_CMD_TIMEOUT_ADAPT_MULT) {
+        return LWCELL_CFG_CMD_TIMEOUT_ADAPT_MAX;
+    }
+    return LWCELL_MAX(l->est * LWCELL_CFG_CMD_TIMEOUT_ADAPT_MULT, LWCELL_CFG_CMD_TIMEOUT_ADAPT_MIN);
+}
+
+#endif /* LWCELL_CFG_CMD_TIMEOUT_ADAPT || __DOXYGEN__ */
+
+#endif /* LWCELL_CFG_CMD_LATENCY || __DOXYGEN__ */
+
 /**
  * \brief           User thread to process input packets from API functions
  * \param[in]       arg: User argument. Semaphore to release when thread starts
@@ -49,6 +130,9 @@ lwcell_thread_produce(void* const arg) {
     lwcell_msg_t* msg;
     lwcellr_t res;
     uint32_t time;
+#if LWCELL_CFG_CMD_LATENCY
+    uint32_t start, budget;
+#endif /* LWCELL_CFG_CMD_LATENCY */
 
     /* Thread is running, unlock semaphore */
     if (lwcell_sys_sem_isvalid(sem)) {
@@ -57,16 +141,68 @@ lwcell_thread_produce(void* const arg) {
 
     lwcell_core_lock();
     while (1) {
+        /* Urgent message goes before anything in queue */
+        msg = e->msg_urgent;
+        e->msg_urgent = NULL;
+
+        /* Commands queued while low priority message is waiting go first, up to the size of queue */
+        if (msg == NULL && e->msg_low_prio != NULL) {
+            if (e->msg_low_prio_skip > 0) {
+                /* Skip empty entries, their urgent messages were already taken */
+                while (lwcell_sys_mbox_getnow(&e->mbox_producer, (void**)&msg) && msg == NULL) {}
+            }
+            if (msg != NULL) {
+                --e->msg_low_prio_skip;
+            } else {
+                msg = e->msg_low_prio;
+                msg->low_prio = 0;
+                e->msg_low_prio = NULL;
+            }
+        }
         lwcell_core_unlock();
-        do {
+        while (msg == NULL) {
             time = lwcell_sys_mbox_get(&e->mbox_producer, (void**)&msg, 0); /* Get message from queue */
-        } while (time == LWCELL_SYS_TIMEOUT || msg == NULL);
-        LWCELL_THREAD_PRODUCER_HOOK();                                      /* Execute producer thread hook */
+            if (time == LWCELL_SYS_TIMEOUT) {
+                msg = NULL;
+            }
+            if (msg == NULL) { /* Empty entry wakes thread for urgent message */
+                lwcell_core_lock();
+                msg = e->msg_urgent;
+                e->msg_urgent = NULL;
+                lwcell_core_unlock();
+            }
+        }
+        LWCELL_THREAD_PRODUCER_HOOK(); /* Execute producer thread hook */
         lwcell_core_lock();
 
+        /* Put low priority message aside, single message can wait at a time */
+        if (msg->low_prio && e->msg_low_prio == NULL) {
+            e->msg_low_prio = msg;
+            e->msg_low_prio_skip = LWCELL_CFG_THREAD_PRODUCER_MBOX_SIZE;
+            continue;
+        }
+
         res = lwcellOK; /* Start with OK */
         e->msg = msg;   /* Set message handle */
 
+#if LWCELL_CFG_PIPE_STATS
+        --e->pipe.queue_depth;
+        lwcelli_pipe_hist_add(&e->pipe_cmd[msg->cmd_def].queue, lwcell_sys_now() - msg->queue_time);
+#endif /* LWCELL_CFG_PIPE_STATS */
+
+#if LWCELL_CFG_CMD_HANDLE
+        if (msg->cancel) {
+            res = lwcellERR; /* Cancelled while waiting in queue */
+        } else if (msg->deadline) {
+            time = lwcell_sys_now() - msg->queue_time;
+            if (time >= msg->block_time) {
+                res = lwcellTIMEOUT; /* Deadline passed while waiting in queue */
+            } else {
+                msg->block_time -= time;
+            }
+        }
+#endif /* LWCELL_CFG_CMD_HANDLE */
+
         /*
          * This check is performed when adding command to queue
          * Do it again here to prevent long timeouts,
@@ -98,9 +234,20 @@ lwcell_thread_produce(void* const arg) {
             lwcell_core_unlock();
             lwcell_sys_sem_wait(&e->sem_sync, 0); /* First call */
             lwcell_core_lock();
+#if LWCELL_CFG_CMD_LATENCY
+            start = lwcell_sys_now();
+            budget = msg->block_time;
+#endif /* LWCELL_CFG_CMD_LATENCY */
+#if LWCELL_CFG_PIPE_STATS
+            e->pipe_fn_time = lwcell_sys_now();
+            e->pipe_wait_byte = 1;
+#endif                                            /* LWCELL_CFG_PIPE_STATS */
             res = msg->fn(msg);                   /* Process this message, check if command started at least */
             time = ~LWCELL_SYS_TIMEOUT;           /* Reset time */
             if (res == lwcellOK) {                /* We have valid data and data were sent */
+#if LWCELL_CFG_CMD_TIMEOUT_ADAPT
+                msg->block_time = cmd_latency_timeout(msg);
+#endif /* LWCELL_CFG_CMD_TIMEOUT_ADAPT */
                 lwcell_core_unlock();
                 time = lwcell_sys_sem_wait(
                     &e->sem_sync,
@@ -109,7 +256,22 @@ lwcell_thread_produce(void* const arg) {
                 if (time == LWCELL_SYS_TIMEOUT) { /* Sync timeout occurred? */
                     res = lwcellTIMEOUT;          /* Timeout on command */
                 }
+#if LWCELL_CFG_PIPE_STATS
+                lwcelli_pipe_hist_add(&e->pipe_cmd[msg->cmd_def].done, lwcell_sys_now() - e->pipe_fn_time);
+#endif /* LWCELL_CFG_PIPE_STATS */
+#if LWCELL_CFG_CMD_LATENCY
+                if (cmd_latency_match(msg, budget)) {
+                    if (res == lwcellOK && msg->res == lwcellOK) {
+                        cmd_latency_record(msg->cmd_def, budget, lwcell_sys_now() - start);
+                    } else if (res == lwcellTIMEOUT) {
+                        e->cmd_latency[msg->cmd_def].cnt = 0; /* Learned latency is no longer trusted */
+                    }
+                }
+#endif /* LWCELL_CFG_CMD_LATENCY */
             }
+#if LWCELL_CFG_PIPE_STATS
+            e->pipe_wait_byte = 0;
+#endif /* LWCELL_CFG_PIPE_STATS */
 
             /* Notify application on command timeout */
             if (res == lwcellTIMEOUT) {
@@ -152,6 +314,19 @@ lwcell_thread_produce(void* const arg) {
             msg->res = res; /* Save response */
         }
 
+#if LWCELL_CFG_CONN_TX_COALESCE
+        /* Finish all send requests merged to this one */
+        if (msg->cmd_def == LWCELL_CMD_CIPSEND) {
+            lwcelli_conn_send_coalesce_finish(msg);
+        }
+#endif /* LWCELL_CFG_CONN_TX_COALESCE */
+
+#if LWCELL_CFG_CMD_HANDLE
+        if (msg->handle != NULL) {
+            msg->handle->msg = NULL; /* Command finished, handle may be reused */
+        }
+#endif /* LWCELL_CFG_CMD_HANDLE */
+
 #if LWCELL_CFG_USE_API_FUNC_EVT
         /* Send event function to user */
         if (msg->evt_fn != NULL) {
@@ -164,10 +339,15 @@ lwcell_thread_produce(void* const arg) {
          * release semaphore and notify finished with processing
          * otherwise directly free memory of message structure
          */
+#if LWCELL_CFG_CMD_HANDLE
+        if (msg->is_blocking && !msg->detached) {
+            msg->released = 1;
+#else  /* LWCELL_CFG_CMD_HANDLE */
         if (msg->is_blocking) {
+#endif /* !LWCELL_CFG_CMD_HANDLE */
             lwcell_sys_sem_release(&msg->sem);
         } else {
-            LWCELL_MSG_VAR_FREE(msg);
+            LWCELL_MSG_VAR_FREE(msg); /* Non-blocking message or caller stopped waiting for it */
         }
         e->msg = NULL;
     }
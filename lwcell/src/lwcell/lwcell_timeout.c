@@ -124,7 +124,7 @@ lwcell_timeout_add(uint32_t time, lwcell_timeout_fn fn, void* arg) {
     LWCELL_ASSERT(fn != NULL);
 
     /* Allocate memory for timeout structure */
-    if ((to = lwcell_mem_calloc(1, sizeof(*to))) == NULL) {
+    if ((to = LWCELL_MEM_CALLOC(1, sizeof(*to), LWCELL_MEM_TAG_TIMEOUT)) == NULL) {
         return lwcellERRMEM;
     }
 